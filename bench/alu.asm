@@ -0,0 +1,40 @@
+info: bench-alu, Benchmark Corpus
+// ALU-bound: long arithmetic loops between foraging steps
+main:
+	mov r5, 6
+crunch:
+	add r6, r5
+	mult r6, 3
+	xor r7, r6
+	shl r7, 1
+	shr r6, 2
+	and r7, 0x7FFF
+	or r8, r7
+	mod r8, 97
+	div r6, 3
+	sub r5, 1
+	cmp r5, 0
+	jg crunch
+	call forage
+	jmp main
+// one step of a simple forager: keeps the organism fed and scoring
+forage:
+	travel r1
+	jns turn
+	sense r2
+	jns fed
+	cmp r2, 0xFFFF
+	je dump
+	eat
+fed:
+	ret
+turn:
+	rand r1, 4
+	ret
+dump:
+	energy r3
+	cmp r3, 3000
+	jl fed
+	sub r3, 2000
+	release r3
+	ret
@@ -0,0 +1,30 @@
+info: bench-cksum, Benchmark Corpus
+// cksum-heavy: checksums its own image every few instructions
+main:
+	mov r6, 0
+	cksum r6, 1000
+	mov r7, 500
+	cksum r7, 3600
+	call forage
+	jmp main
+// one step of a simple forager: keeps the organism fed and scoring
+forage:
+	travel r1
+	jns turn
+	sense r2
+	jns fed
+	cmp r2, 0xFFFF
+	je dump
+	eat
+fed:
+	ret
+turn:
+	rand r1, 4
+	ret
+dump:
+	energy r3
+	cmp r3, 3000
+	jl fed
+	sub r3, 2000
+	release r3
+	ret
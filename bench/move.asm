@@ -0,0 +1,32 @@
+info: bench-move, Benchmark Corpus
+// movement-bound: a travel every few instructions
+main:
+	rand r1, 4
+	mov r5, 10
+walk:
+	call forage
+	sub r5, 1
+	cmp r5, 0
+	jg walk
+	jmp main
+// one step of a simple forager: keeps the organism fed and scoring
+forage:
+	travel r1
+	jns turn
+	sense r2
+	jns fed
+	cmp r2, 0xFFFF
+	je dump
+	eat
+fed:
+	ret
+turn:
+	rand r1, 4
+	ret
+dump:
+	energy r3
+	cmp r3, 3000
+	jl fed
+	sub r3, 2000
+	release r3
+	ret
@@ -0,0 +1,35 @@
+info: bench-pokepeek, Benchmark Corpus
+// poke/peek-heavy: probes every neighbour between steps, writing a nop
+// over the neighbour's data area so victims are not derailed
+main:
+	mov r5, 0
+probe:
+	peek r6, 3590
+	mov r0, r6
+	poke r5, 3591
+	add r5, 1
+	cmp r5, 4
+	jl probe
+	call forage
+	jmp main
+// one step of a simple forager: keeps the organism fed and scoring
+forage:
+	travel r1
+	jns turn
+	sense r2
+	jns fed
+	cmp r2, 0xFFFF
+	je dump
+	eat
+fed:
+	ret
+turn:
+	rand r1, 4
+	ret
+dump:
+	energy r3
+	cmp r3, 3000
+	jl fed
+	sub r3, 2000
+	release r3
+	ret
@@ -0,0 +1,47 @@
+info: bench-selfmod, Benchmark Corpus
+// self-modifying: rewrites the immediate of an instruction it is about to
+// run, and retargets a call (immediate targets are relative to the call)
+main:
+	rand r5, 100
+	mov r4, patch
+	mov [r4+2], r5
+patch:
+	add r6, 1
+	cmp r5, 50
+	jl left
+	mov r4, right
+	jmp aim
+left:
+	mov r4, forage
+aim:
+	sub r4, hop
+	mov r7, hop
+	mov [r7+1], r4
+hop:
+	call forage
+	jmp main
+right:
+	call forage
+	call forage
+	ret
+// one step of a simple forager: keeps the organism fed and scoring
+forage:
+	travel r1
+	jns turn
+	sense r2
+	jns fed
+	cmp r2, 0xFFFF
+	je dump
+	eat
+fed:
+	ret
+turn:
+	rand r1, 4
+	ret
+dump:
+	energy r3
+	cmp r3, 3000
+	jl fed
+	sub r3, 2000
+	release r3
+	ret
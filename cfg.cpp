@@ -0,0 +1,580 @@
+//----------------------------------------------------------------------------
+//
+// cfg.cpp
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#endif // #ifdef WIN32
+
+#include "cfg.h"
+#include "disasm.h"
+
+#include <cstring>
+#include <algorithm>
+
+using namespace std;
+
+#define NO_BLOCK	0xFFFF
+
+static bool isJump(uint16 op)
+{
+	return(op >= OPCODE_JMP && op <= OPCODE_JNS);
+}
+
+// instructions after which a new block starts
+static bool endsBlock(uint16 op)
+{
+	return(isJump(op) || op == OPCODE_CALL || op == OPCODE_RET);
+}
+
+static uint16 nextIP(uint16 ip)
+{
+	ip += INSTR_SLOTS;
+	return(ip > MAX_DNA-INSTR_SLOTS ? START_IP : ip);
+}
+
+ControlFlowGraph::ControlFlowGraph(const uint16 *dna, uint16 programSize)
+{
+	memcpy(m_dna,dna,sizeof(m_dna));
+	m_programSize = programSize;
+
+	findBlocks();
+	findLoops();
+}
+
+// where an immediate jmp/call lands, as Organism::jmp and validateIP have it
+uint16 ControlFlowGraph::target(uint16 ip, uint16 delta)
+{
+	uint32 t = (uint16)(ip + delta);
+
+	if (t % INSTR_SLOTS != 0)
+		t = (t / INSTR_SLOTS + 1) * INSTR_SLOTS;
+	return(t > MAX_DNA-INSTR_SLOTS ? START_IP : (uint16)t);
+}
+
+void ControlFlowGraph::findBlocks(void)
+{
+	bool reached[CFG_NUM_SLOTS] = {false}, leader[CFG_NUM_SLOTS] = {false};
+	vector<uint16> work, entries;
+	uint16 slot;
+
+	// everything directly reachable from the start
+
+	reached[0] = leader[0] = true;
+	entries.push_back(START_IP);
+	work.push_back(START_IP);
+
+	while (work.size() > 0)
+	{
+		uint16 ip = work.back();
+		uint16 op = m_dna[ip] & OPCODE_MASK;
+		bool immed = (m_dna[ip] >> 14) == ADDR_MODE_IMMED;
+		uint16 succs[2];
+		int numSuccs = 0;
+
+		work.pop_back();
+
+		if (op != OPCODE_JMP && op != OPCODE_RET)
+			succs[numSuccs++] = nextIP(ip);
+		if (endsBlock(op))
+			leader[nextIP(ip) / INSTR_SLOTS] = true;
+
+		if (isJump(op) || op == OPCODE_CALL)
+		{
+			if (immed == false)
+				m_indirect.push_back(ip);
+			else
+			{
+				uint16 t = target(ip,m_dna[ip+1]);
+				leader[t / INSTR_SLOTS] = true;
+				succs[numSuccs++] = t;
+				if (op == OPCODE_CALL && find(entries.begin(),entries.end(),t) == entries.end())
+					entries.push_back(t);
+			}
+		}
+
+		for (int i=0;i<numSuccs;i++)
+		{
+			slot = succs[i] / INSTR_SLOTS;
+			if (reached[slot] == false)
+			{
+				reached[slot] = true;
+				work.push_back(succs[i]);
+			}
+		}
+	}
+
+	sort(m_indirect.begin(),m_indirect.end());
+
+	// cut the reached instructions into blocks
+
+	for (slot=0;slot<CFG_NUM_SLOTS;slot++)
+	{
+		m_blockOf[slot] = NO_BLOCK;
+		if (reached[slot] == false)
+			continue;
+
+		bool start = leader[slot] || reached[slot-1] == false ||
+					 endsBlock(m_dna[(slot-1)*INSTR_SLOTS] & OPCODE_MASK);
+		if (start)
+		{
+			CfgBlock b;
+			b.start = b.end = slot * INSTR_SLOTS;
+			b.numInstrs = b.numTravels = b.numCalls = 0;
+			b.ret = b.indirect = false;
+			m_blocks.push_back(b);
+		}
+
+		CfgBlock &b = m_blocks.back();
+		uint16 op = m_dna[slot*INSTR_SLOTS] & OPCODE_MASK;
+
+		m_blockOf[slot] = (uint16)(m_blocks.size()-1);
+		b.end = (slot+1) * INSTR_SLOTS;
+		b.numInstrs++;
+		if (op == OPCODE_TRAVEL)
+			b.numTravels++;
+		else if (op == OPCODE_CALL)
+			b.numCalls++;
+	}
+
+	for (uint16 i=0;i<entries.size();i++)
+		m_functions.push_back(m_blockOf[entries[i] / INSTR_SLOTS]);
+
+	// edges from each block's last instruction
+
+	for (uint16 i=0;i<m_blocks.size();i++)
+	{
+		CfgBlock &b = m_blocks[i];
+		uint16 ip = b.end - INSTR_SLOTS;
+		uint16 op = m_dna[ip] & OPCODE_MASK;
+		bool immed = (m_dna[ip] >> 14) == ADDR_MODE_IMMED;
+		CfgEdge e;
+
+		e.back = false;
+		b.ret = op == OPCODE_RET;
+		b.indirect = (isJump(op) || op == OPCODE_CALL) && immed == false;
+
+		if (op != OPCODE_JMP && op != OPCODE_RET)
+		{
+			e.to = m_blockOf[nextIP(ip) / INSTR_SLOTS];
+			e.kind = CFG_EDGE_FALL;
+			b.succs.push_back(e);
+		}
+		if ((isJump(op) || op == OPCODE_CALL) && immed)
+		{
+			e.to = m_blockOf[target(ip,m_dna[ip+1]) / INSTR_SLOTS];
+			e.kind = op == OPCODE_CALL ? CFG_EDGE_CALL : CFG_EDGE_JUMP;
+			b.succs.push_back(e);
+		}
+
+		for (uint16 j=0;j<b.succs.size();j++)
+			if (b.succs[j].kind != CFG_EDGE_CALL)
+				m_blocks[b.succs[j].to].preds.push_back(i);
+	}
+}
+
+bool ControlFlowGraph::dominates(uint16 a, uint16 b)
+{
+	uint16 root = (uint16)m_blocks.size();
+
+	for (;;)
+	{
+		if (b == a)
+			return(true);
+		if (b == root)
+			return(false);
+		b = m_idom[b];
+	}
+}
+
+// dominators (Cooper, Harvey and Kennedy) over jump and fall-through
+// edges, from a virtual root above every function entry; then natural loops
+// from the edges back to a dominator
+
+void ControlFlowGraph::findLoops(void)
+{
+	uint16 numBlocks = (uint16)m_blocks.size(), root = numBlocks;
+	vector<uint16> order, rpoNum(numBlocks+1,NO_BLOCK);
+	vector<bool> visited(numBlocks+1,false);
+	uint16 i, j;
+
+	// reverse postorder by an explicit-stack DFS
+	{
+		vector<pair<uint16,uint16> > stack;
+		stack.push_back(make_pair(root,(uint16)0));
+		visited[root] = true;
+		while (stack.size() > 0)
+		{
+			uint16 n = stack.back().first, k = stack.back().second++;
+			uint16 count = (uint16)(n == root ? m_functions.size() : m_blocks[n].succs.size());
+
+			if (k >= count)
+			{
+				order.push_back(n);
+				stack.pop_back();
+				continue;
+			}
+			if (n != root && m_blocks[n].succs[k].kind == CFG_EDGE_CALL)
+				continue;
+
+			uint16 next = n == root ? m_functions[k] : m_blocks[n].succs[k].to;
+			if (visited[next] == false)
+			{
+				visited[next] = true;
+				stack.push_back(make_pair(next,(uint16)0));
+			}
+		}
+		reverse(order.begin(),order.end());
+		for (i=0;i<order.size();i++)
+			rpoNum[order[i]] = i;
+	}
+
+	m_idom.assign(numBlocks+1,NO_BLOCK);
+	m_idom[root] = root;
+
+	for (bool changed=true;changed;)
+	{
+		changed = false;
+		for (i=1;i<order.size();i++)
+		{
+			uint16 n = order[i], newIdom = NO_BLOCK;
+			vector<uint16> preds = m_blocks[n].preds;
+
+			if (find(m_functions.begin(),m_functions.end(),n) != m_functions.end())
+				preds.push_back(root);
+
+			for (j=0;j<preds.size();j++)
+			{
+				uint16 p = preds[j];
+				if (m_idom[p] == NO_BLOCK)
+					continue;
+				if (newIdom == NO_BLOCK)
+				{
+					newIdom = p;
+					continue;
+				}
+
+				uint16 a = p, b = newIdom;
+				while (a != b)
+				{
+					while (rpoNum[a] > rpoNum[b])
+						a = m_idom[a];
+					while (rpoNum[b] > rpoNum[a])
+						b = m_idom[b];
+				}
+				newIdom = a;
+			}
+			if (m_idom[n] != newIdom)
+			{
+				m_idom[n] = newIdom;
+				changed = true;
+			}
+		}
+	}
+
+	// one loop per header, over all of its back edges
+
+	vector<uint16> loopOf(numBlocks,NO_BLOCK);
+
+	for (i=0;i<numBlocks;i++)
+	{
+		for (j=0;j<m_blocks[i].succs.size();j++)
+		{
+			CfgEdge &e = m_blocks[i].succs[j];
+			if (e.kind == CFG_EDGE_CALL || m_idom[i] == NO_BLOCK || dominates(e.to,i) == false)
+				continue;
+
+			e.back = true;
+			if (loopOf[e.to] == NO_BLOCK)
+			{
+				CfgLoop loop;
+				loop.header = e.to;
+				loop.depth = 0;
+				loop.exits = false;
+				loop.reducible = true;
+				loop.minInstrs = loop.maxInstrs = loop.minEnergy = loop.maxEnergy = 0;
+				loop.travels = loop.calls = 0;
+				loop.blocks.push_back(e.to);
+				loopOf[e.to] = (uint16)m_loops.size();
+				m_loops.push_back(loop);
+			}
+
+			// everything that reaches the latch without passing the header
+			CfgLoop &loop = m_loops[loopOf[e.to]];
+			vector<uint16> work(1,i);
+			while (work.size() > 0)
+			{
+				uint16 n = work.back();
+				work.pop_back();
+				if (find(loop.blocks.begin(),loop.blocks.end(),n) != loop.blocks.end())
+					continue;
+				loop.blocks.push_back(n);
+				for (uint16 k=0;k<m_blocks[n].preds.size();k++)
+					work.push_back(m_blocks[n].preds[k]);
+			}
+		}
+	}
+
+	for (i=0;i<m_loops.size();i++)
+	{
+		m_loops[i].depth = 0;
+		for (j=0;j<m_loops.size();j++)
+		{
+			vector<uint16> &outer = m_loops[j].blocks;
+			if (j != i && outer.size() > m_loops[i].blocks.size() &&
+				find(outer.begin(),outer.end(),m_loops[i].header) != outer.end())
+				m_loops[i].depth++;
+		}
+		costLoop(m_loops[i]);
+	}
+}
+
+// cheapest and dearest trip from the header back to it, over the body with
+// every back edge removed.  Travel only costs TRAVEL_ENERGY when it moves,
+// so the cheapest trip assumes it never does and the dearest that it always
+// does.
+
+void ControlFlowGraph::costLoop(CfgLoop &loop)
+{
+	uint16 numBlocks = (uint16)m_blocks.size(), i, j;
+	vector<bool> inBody(numBlocks,false);
+	vector<uint16> indegree(numBlocks,0), ready;
+	vector<uint32> minI(numBlocks,0xFFFFFFFF), maxI(numBlocks,0), maxE(numBlocks,0);
+	uint32 done = 0;
+
+	for (i=0;i<loop.blocks.size();i++)
+		inBody[loop.blocks[i]] = true;
+
+	loop.exits = false;
+	loop.travels = loop.calls = 0;
+	for (i=0;i<loop.blocks.size();i++)
+	{
+		CfgBlock &b = m_blocks[loop.blocks[i]];
+
+		loop.travels += b.numTravels;
+		loop.calls += b.numCalls;
+		if (b.ret || b.indirect)
+			loop.exits = true;
+		for (j=0;j<b.succs.size();j++)
+		{
+			const CfgEdge &e = b.succs[j];
+			if (e.kind == CFG_EDGE_CALL)
+				continue;
+			if (inBody[e.to] == false)
+				loop.exits = true;
+			else if (e.back == false)
+				indegree[e.to]++;
+		}
+	}
+
+	// longest/shortest paths in topological order
+	CfgBlock &h = m_blocks[loop.header];
+	minI[loop.header] = maxI[loop.header] = h.numInstrs;
+	maxE[loop.header] = h.numInstrs * COMPUTE_ENERGY + h.numTravels * TRAVEL_ENERGY;
+	ready.push_back(loop.header);
+
+	loop.minInstrs = 0xFFFFFFFF;
+	loop.maxInstrs = loop.maxEnergy = 0;
+
+	while (ready.size() > 0)
+	{
+		uint16 n = ready.back();
+		ready.pop_back();
+		done++;
+
+		for (j=0;j<m_blocks[n].succs.size();j++)
+		{
+			const CfgEdge &e = m_blocks[n].succs[j];
+			if (e.kind == CFG_EDGE_CALL || inBody[e.to] == false)
+				continue;
+			if (e.back)
+			{
+				if (e.to == loop.header && minI[n] != 0xFFFFFFFF)
+				{
+					loop.minInstrs = min(loop.minInstrs,minI[n]);
+					loop.maxInstrs = max(loop.maxInstrs,maxI[n]);
+					loop.maxEnergy = max(loop.maxEnergy,maxE[n]);
+				}
+				continue;
+			}
+
+			CfgBlock &b = m_blocks[e.to];
+			if (minI[n] != 0xFFFFFFFF)
+			{
+				minI[e.to] = min(minI[e.to],minI[n] + b.numInstrs);
+				maxI[e.to] = max(maxI[e.to],maxI[n] + b.numInstrs);
+				maxE[e.to] = max(maxE[e.to],maxE[n] + b.numInstrs * COMPUTE_ENERGY + b.numTravels * TRAVEL_ENERGY);
+			}
+			if (--indegree[e.to] == 0)
+				ready.push_back(e.to);
+		}
+	}
+
+	// a cycle that skipped the header means a second way in
+	loop.reducible = done == loop.blocks.size();
+	loop.minEnergy = loop.minInstrs * COMPUTE_ENERGY;
+}
+
+void ControlFlowGraph::printReport(FILE *out, const std::string &name)
+{
+	uint16 i, j;
+	uint16 numSlots = (uint16)((m_programSize + INSTR_SLOTS - 1) / INSTR_SLOTS);
+
+	fprintf(out,"Control flow of %s:\n\n",name.c_str());
+	fprintf(out,"%u basic blocks, %u functions, %u loops, %u indirect jumps/calls\n",
+			(uint32)m_blocks.size(),(uint32)m_functions.size(),(uint32)m_loops.size(),(uint32)m_indirect.size());
+
+	fprintf(out,"\nFunctions (START_IP and call targets):\n");
+	for (i=0;i<m_functions.size();i++)
+		fprintf(out,"  %04d\n",m_blocks[m_functions[i]].start);
+
+	// outer loops first within each header order
+	vector<uint16> loops;
+	for (i=0;i<m_loops.size();i++)
+		loops.push_back(i);
+	for (i=1;i<loops.size();i++)
+		for (j=i;j>0 && m_blocks[m_loops[loops[j]].header].start < m_blocks[m_loops[loops[j-1]].header].start;j--)
+			swap(loops[j],loops[j-1]);
+
+	fprintf(out,"\nLoops (per trip: inner loops counted once, calls not included):\n");
+	if (loops.size() == 0)
+		fprintf(out,"  none\n");
+	for (i=0;i<loops.size();i++)
+	{
+		CfgLoop &l = m_loops[loops[i]];
+		uint16 first = MAX_DNA, last = 0;
+
+		for (j=0;j<l.blocks.size();j++)
+		{
+			first = min(first,m_blocks[l.blocks[j]].start);
+			last = max(last,(uint16)(m_blocks[l.blocks[j]].end - INSTR_SLOTS));
+		}
+
+		fprintf(out,"  %*sheader %04d (%04d-%04d)  %u blocks  ",l.depth*2,"",
+				m_blocks[l.header].start,first,last,(uint32)l.blocks.size());
+		if (l.reducible)
+			fprintf(out,"instrs %u-%u  energy %u-%u",l.minInstrs,l.maxInstrs,l.minEnergy,l.maxEnergy);
+		else
+			fprintf(out,"irreducible: cost unknown");
+		fprintf(out,"  travel %u  calls %u%s\n",l.travels,l.calls,l.exits ? "" : "  never exits");
+	}
+
+	if (m_indirect.size() > 0)
+	{
+		DisAsm d(m_dna,NULL);
+		char line[DISASM_LINE_SIZE];
+
+		fprintf(out,"\nIndirect jumps/calls (targets not followed):\n");
+		for (i=0;i<m_indirect.size();i++)
+		{
+			d.formatListingLine(line,m_indirect[i]);
+			fprintf(out,"  %s\n",line);
+		}
+	}
+
+	// anything in the program that direct control flow never gets to
+	fprintf(out,"\n%s:\n",m_indirect.size() > 0 ? "Reachable only through indirect jumps/calls, or data" :
+												  "Unreachable (dead code or data)");
+	bool any = false;
+	for (i=0;i<numSlots;)
+	{
+		if (m_blockOf[i] != NO_BLOCK)
+		{
+			i++;
+			continue;
+		}
+		for (j=i;j<numSlots && m_blockOf[j] == NO_BLOCK;j++)
+			;
+		fprintf(out,"  %04d-%04d  (%u instructions)\n",i*INSTR_SLOTS,(j-1)*INSTR_SLOTS,(uint32)(j-i));
+		any = true;
+		i = j;
+	}
+	if (any == false)
+		fprintf(out,"  none\n");
+}
+
+// Graphviz: back edges are red, calls dashed, indirect transfers dotted
+// into a "?" node
+
+bool ControlFlowGraph::writeDot(const std::string &file, std::string &error)
+{
+	FILE *out = fopen(file.c_str(),"w");
+	if (out == NULL)
+	{
+		error = "unable to create " + file;
+		return(false);
+	}
+
+	DisAsm d(m_dna,NULL);
+	char line[DISASM_LINE_SIZE];
+	uint16 i, j, ip;
+
+	fprintf(out,"digraph cfg {\n");
+	fprintf(out,"\tnode [shape=box, fontname=\"Courier\", fontsize=10];\n");
+	for (i=0;i<m_blocks.size();i++)
+	{
+		CfgBlock &b = m_blocks[i];
+
+		fprintf(out,"\tb%04d [label=\"",b.start);
+		for (ip=b.start;ip<b.end;ip+=INSTR_SLOTS)
+		{
+			d.formatInstruction(line,ip);
+			fprintf(out,"%04d  %s\\l",ip,line);
+		}
+		fprintf(out,"\"%s];\n",find(m_functions.begin(),m_functions.end(),i) != m_functions.end() ? ", penwidth=2" : "");
+
+		for (j=0;j<b.succs.size();j++)
+		{
+			const CfgEdge &e = b.succs[j];
+			fprintf(out,"\tb%04d -> b%04d",b.start,m_blocks[e.to].start);
+			if (e.kind == CFG_EDGE_CALL)
+				fprintf(out," [style=dashed, label=\"call\"]");
+			else if (e.back)
+				fprintf(out," [color=red]");
+			else if (e.kind == CFG_EDGE_JUMP)
+				fprintf(out," [label=\"T\"]");
+			fprintf(out,";\n");
+		}
+		if (b.indirect)
+			fprintf(out,"\tb%04d -> indirect [style=dotted];\n",b.start);
+	}
+	if (m_indirect.size() > 0)
+		fprintf(out,"\tindirect [shape=ellipse, label=\"?\"];\n");
+	fprintf(out,"}\n");
+
+	fclose(out);
+	return(true);
+}
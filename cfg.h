@@ -0,0 +1,117 @@
+//----------------------------------------------------------------------------
+//
+// cfg.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+#ifndef _CFG_H_
+
+#define _CFG_H_
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "types.h"
+#include "constants.h"
+
+#define CFG_EDGE_FALL		0		// next instruction, or a not-taken branch
+#define CFG_EDGE_JUMP		1		// taken jmp/jcc
+#define CFG_EDGE_CALL		2		// call target; the call also falls through
+
+#define CFG_NUM_SLOTS		(MAX_DNA/INSTR_SLOTS)
+
+struct CfgEdge
+{
+	uint16	to;				// block index
+	uint16	kind;			// CFG_EDGE_*
+	bool	back;			// closes a loop
+};
+
+// a run of instructions only entered at the top
+struct CfgBlock
+{
+	uint16	start, end;		// first IP and one past the last
+	uint16	numInstrs, numTravels, numCalls;
+	bool	ret;			// ends in ret
+	bool	indirect;		// ends in a jmp/jcc/call through a register or memory
+	std::vector<CfgEdge>	succs;
+	std::vector<uint16>		preds;		// through fall/jump edges only
+};
+
+struct CfgLoop
+{
+	uint16	header;			// block index
+	std::vector<uint16>	blocks;
+	uint16	depth;			// 0 for an outermost loop
+	bool	exits;
+	bool	reducible;		// false: no single entry, costs are not known
+	uint32	minInstrs, maxInstrs;
+	uint32	minEnergy, maxEnergy;
+	uint32	travels, calls;
+};
+
+// static analysis of a compiled program.  Only direct control flow is
+// followed from START_IP: jumps and calls through registers or memory are
+// listed, and what only they could reach is reported rather than analysed.
+// Loop costs are per trip round the loop body along its cheapest and
+// dearest paths; inner loops count once and called code is not included.
+
+class ControlFlowGraph
+{
+public:
+	ControlFlowGraph(const uint16 *dna, uint16 programSize);
+
+	void printReport(FILE *out, const std::string &name);
+	bool writeDot(const std::string &file, std::string &error);
+
+private:
+	void findBlocks(void);
+	void findLoops(void);
+	void costLoop(CfgLoop &loop);
+	bool dominates(uint16 a, uint16 b);
+	uint16 target(uint16 ip, uint16 delta);
+
+private:
+	uint16					m_dna[MAX_DNA];
+	uint16					m_programSize;		// in words
+	std::vector<CfgBlock>	m_blocks;
+	std::vector<CfgLoop>	m_loops;
+	std::vector<uint16>		m_functions;		// entry blocks
+	std::vector<uint16>		m_indirect;			// IPs of indirect transfers
+	std::vector<uint16>		m_idom;				// immediate dominators
+	uint16					m_blockOf[CFG_NUM_SLOTS];
+};
+
+#endif // #ifndef _CFG_H_
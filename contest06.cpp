@@ -1,494 +1,1752 @@
-//----------------------------------------------------------------------------
-//
-// contest06.cpp
-//
-//----------------------------------------------------------------------------
-//
-// Copyright (c) 2006, Symantec Corporation All rights reserved.
-//
-// Redistribution and use in source and binary forms, with or without
-// modification, are permitted provided that the following conditions are
-// met:
-//
-// -  Redistributions of source code must retain the above copyright notice,
-// this list of conditions and the following disclaimer. 
-//
-// -  Redistributions in binary form must reproduce the above copyright
-// notice, this list of conditions and the following disclaimer in the
-// documentation and/or other materials provided with the distribution. 
-//
-// - Neither the name of Symantec Corp. nor the names of its contributors
-// may be used to endorse or promote products derived from this software
-// without specific prior written permission. 
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
-// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
-// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
-// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-//
-
-#ifdef WIN32
-#pragma warning(disable:4786)
-#endif // #ifdef WIN32
-
-#include <stdio.h>
-#include <stdlib.h>
-#include <string>
-#include <cstring>
-#include <vector>
-#include <algorithm>
-
-#include "settings.h"
-#include "world.h"
-#include "organism.h"
-#include "compiler.h"
-#include "mycon.h"
-#include "disasm.h"
-
-#include "drone.h"	 
-
-using namespace std;
-
-void myRandomize(const Settings & s)
-{
-	myrand((uint32)s.getSeed());
-	//srand(time(NULL));
-}
-
-void removeNewline(char *s)
-{
-	char * ptr = strchr(s,'\n');
-	if (ptr)
-		*ptr = 0;
-	ptr = strchr(s,'\r');
-	if (ptr)
-		*ptr = 0;
-}
-
-
-void printDisassembly(std::string fileToDisasm)
-{
-	Compiler c;
-	string error;
-
-	if (c.compile(fileToDisasm,error) == false)
-	{
-		printf("Error compiling source file:\n %s\n",error.c_str());
-		return;
-	}
-
-	OrganismBinary *ob = c.getProgram();
-	if (ob == NULL)
-	{
-		printf("Error compiling player file:\n program size exceeds NANORG memory size\n");
-		return;
-	}
-
-	uint16 arr[MAX_DNA] = {0};
-
-	ob->getProgram(arr);
-
-	DisAsm	d(arr,NULL);
-
-	vector<string>	v;
-
-	printf("Disassembly of %s:\n\n",fileToDisasm.c_str());
-
-	d.getDisassembly(v,0,MAX_DNA);
-	for (unsigned int i=0;i<v.size();i++)
-		printf("%s\n",v[i].c_str());
-
-	delete ob;
-}
-
-bool oneRound
-(
-	Settings &s, 
-	OrganismBinary *player, 
-	OrganismBinary *drone, 
-	double *finalScore,
-	uint16 *finalOrgs,
-	uint16 *finalDrones,
-	uint32 *finalTickNum
-)
-{
-	myRandomize(s);
-
-	CConsole	*cc = new CConsole(s.getQuiet());
-	if (cc == NULL)
-		return(false);
-
-	World w(&s,cc);
-	if (w.populateWorld(player,drone) == false)
-		return(false);
-
-	w.run();
-
-	cc->clearScreen();
-	delete cc;
-
-	if (finalScore != NULL)
-		*finalScore = w.getScore();
-	if (finalOrgs != NULL && finalDrones != NULL)
-		w.getNumAlive(finalOrgs,finalDrones);
-	if (finalTickNum != NULL)
-		*finalTickNum = w.getTickNum();
-
-	return(true);
-}
-
-OrganismBinary *getDrone(void)
-{
-	unsigned short arr[MAX_DNA];
-
-	for (int i=0;i<MAX_DNA;i++)
-		arr[i] = droneArray[i] ^ 0xBABE;
-
-	return (new OrganismBinary(arr,MAX_DNA,DRONE_STRING));
-}
-
-std::string getCommaDelimitedNumber(double number)
-{
-	char temp[256];
-	std::string result;
-	int i,j;
-
-	sprintf(temp,"%.0lf",number);
-	for (j=1,i=strlen(temp)-1;i >= 0;--i,++j)
-	{
-		result = temp[i] + result;
-		if (j % 3 == 0 && i > 0)
-			result = "," + result;
-	}
-
-	return(result);
-}
-
-bool runSingle(Settings &s)
-{
-	string error;
-
-	// if we're running a tournament then we don't want to run a single run...
-	if (s.getTournamentFile().length() > 0)
-		return(false);
-	
-	if (s.getPlayerFile() == "")
-	{
-		printf("No player file specified\n");
-		return(false);
-	}
-	/*
-	if (s.getDroneFile() == "")
-	{
-		printf("No drone file specified\n");
-		return(false);
-	}
-	*/
-
-	myRandomize(s);
-
-	Compiler c;
-
-	if (c.compile(s.getPlayerFile(),error) == false)
-	{
-		printf("Error compiling player file:\n %s\n",error.c_str());
-		return(false);
-	}
-
-	OrganismBinary *playerOB = c.getProgram();
-	if (playerOB == NULL)
-	{
-		printf("Error compiling player file:\n program size exceeds NANORG memory size\n");
-		return(false);
-	}
-
-	/*
-	c.reset();
-
-	if (c.compile(s.getDroneFile(),error) == false)
-	{
-		printf("Error compiling drone file:\n %s\n",error.c_str());
-		return(false);
-	}
-	*/
-
-	// our drone is encoded internally; don't load from a file
-	OrganismBinary *droneOB = getDrone();	// c.getProgram();
-
-	CConsole	*cc = new CConsole(s.getQuiet());
-	if (cc == NULL)
-	{
-		delete playerOB;
-		delete droneOB;
-		printf("Error initializing text graphics library\n");
-		return(false);
-	}
-
-	double finalScore = 0;
-	uint32 finalTick;
-	uint16 orgs, drones;
-
-	oneRound(s,playerOB,droneOB,&finalScore,&orgs,&drones,&finalTick);
-	printf("Entrant: %s\n",playerOB->getModuleInfo().c_str());
-	printf("Your score: %s\n",getCommaDelimitedNumber(finalScore).c_str());
-	printf("Live organisms: %d, Live drones: %d, Final tick #: %d, Seed: %u\n",
-		orgs, 
-		drones, 
-		finalTick,
-		s.getSeed());
-
-	delete playerOB;
-	delete droneOB;
-
-  	return(true);
-
-}
-
-void runTrials
-(
-	Settings &s,
-	vector<uint32> &seeds,
-	OrganismBinary *droneOB,
-	OrganismBinary *playerOB,
-	vector<NANORG_RESULT> & results
-)
-{
-	s.setQuiet(true);
-
-	double finalScore = 0;
-	double totalScore = 0;
-
-	for (size_t i=0;i<seeds.size();i++)
-	{
-		printf(" Evaluating %s: %lu of %lu\r",playerOB->getModuleName().c_str(),i+1,seeds.size());
-		s.setSeed(seeds[i]);
-
-		if (oneRound(s, playerOB, droneOB, &finalScore,NULL,NULL,NULL) == true)
-		{
-			totalScore += finalScore;
-		}
-		else
-		{
-			NANORG_RESULT	r(0,playerOB->getModuleInfo(),"Memory allocation error");
-			results.push_back(r);
-			return;
-		}
-	}
-
-	printf("\n");
-
-	NANORG_RESULT r(totalScore,playerOB->getModuleInfo(),"");
-	results.push_back(r);
-}
-
-
-/* 
-format of tournament file:
-
-  results filename
-  list of seeds, one per line
-  blank line
-  drone filename.asm
-  list of asm files to test
-
-*/
-
-
-bool runTournament(Settings &s)
-{
-	// must have a tournament file
-	if (s.getTournamentFile().length() == 0)
-		return(false);
-
-	FILE *stream = fopen(s.getTournamentFile().c_str(),"rt");
-	if (stream == NULL)
-	{
-		printf("Unable to open tournament configuration file: %s\n",s.getTournamentFile().c_str());
-		return(false);
-	}
-
-	FILE	*rstream;
-	char	temp[512];
-	string	resultFile;
-
-	// get results filename
-	if (fgets(temp,511,stream) != NULL)
-	{
-		removeNewline(temp);
-		resultFile = temp;
-		rstream = fopen(temp,"wt");
-		if (rstream == NULL)
-		{
-			printf("Unable to create results file: %s\n",temp);
-			return(false);
-		}
-	}
-	else
-	{
-		fclose(stream);
-		printf("Improperly formatted tournament configuration file: %s\n",s.getTournamentFile().c_str());
-		return(false);
-	}
-
-	vector<uint32>		seeds;
-
-	while (!feof(stream))
-	{
-		if (fgets(temp,511,stream) != NULL)
-		{
-			uint32 val = (uint32)atol(temp);
-			if (val == 0)
-				break;
-			seeds.push_back(val);
-		}
-	}
-
-	if (feof(stream))
-	{
-		fclose(rstream);
-		fclose(stream);
-		printf("Missing organism filenames in tournament configuration file\n");
-		return(false);
-	}
-
-	string error;
-	OrganismBinary *droneOB, *playerOB;
-
-	// use internal encoding for drone
-	droneOB = getDrone();
-
-	/*
-	if (fgets(temp,511,stream) != NULL)
-	{
-		// got the drone filename...
-		Compiler c;
-
-		removeNewline(temp);
-
-		if (c.compile(temp,error) == false)
-		{
-			fclose(rstream);
-			printf("Error compiling drone file:\n %s\n",error.c_str());
-			return(false);
-		}
-
-		droneOB = c.getProgram();
-	}
-	*/
-
-	vector<NANORG_RESULT>		results;
-
-	printf("Running tournament...\n");
-
-	while (!feof(stream))
-	{
-		if (fgets(temp,511,stream) != NULL)
-		{
-			// got the first competitor filename...
-			Compiler c;
-
-			removeNewline(temp);
-
-			if (strlen(temp) == 0)
-				continue;
-
-			if (c.compile(temp,error) == false)
-			{
-				NANORG_RESULT	r(0,temp,error);
-				results.push_back(r);
-				printf(" Evaluating %s: Error (%s)\n",temp,error.c_str());
-				continue;
-			}
-
-			playerOB = c.getProgram();
-			if (playerOB == NULL)
-			{
-				NANORG_RESULT	r(0,temp,"program size exceeds NANORG memory size");
-				results.push_back(r);
-				printf(" Evaluating %s: Error (program size exceeds NANORG memory size)\n",temp);
-				continue;
-			}
- 
-
-			runTrials(s,seeds,droneOB,playerOB,results);
-
-			delete playerOB;
-			playerOB = NULL;
-		}
-	}
-
-	sort(results.begin(), results.end());		// sorts ascending
-
-	printf("Writing results to %s...\n",resultFile.c_str());
-
-	for(int i=results.size()-1;i>=0;--i)
-	{
-		if (results[i].result.length())
-			fprintf(rstream,"%.0lf %s (%s)\n",
-								results[i].totalScore,
-								results[i].moduleInfo.c_str(),
-								results[i].result.c_str());
-		else
-			fprintf(rstream,"%.0lf %s\n",
-								results[i].totalScore,
-								results[i].moduleInfo.c_str());
-	}
-
-	delete droneOB;
-
-	fclose(rstream);
-	fclose(stream);
-
-	return(true);
-}
-
-
-bool printDisassembly(const Settings &s)
-{
-	if (s.getPrintFile().length() > 0)
-	{
-		printDisassembly(s.getPrintFile());
-		return(true);
-	}
-	return(false);
-}
-
-int main(int argc, char *argv[])
-{
-	Settings s;
-	string error;
-	
-	if (s.LoadSettings(argc,argv,error) == false)
-	{
-		printf("Error loading settings:\n %s\n",error.c_str());
-		return(-1);
-	}
-
-	if (printDisassembly(s) == true)
-	{
-		return(0);
-	}
-
-	if (runSingle(s) == true)
-	{
-		return(0);
-	}
-
-	if (runTournament(s) == true)
-	{
-		return(0);
-	}
-
-	// must have been an error
-  	return(-1);
-}
-
-// when using -q, show final map status at the end
-// highlight debug char in special color
+//----------------------------------------------------------------------------
+//
+// contest06.cpp
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer. 
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution. 
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission. 
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#endif // #ifdef WIN32
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+#include "settings.h"
+#include "world.h"
+#include "organism.h"
+#include "compiler.h"
+#include "mycon.h"
+#include "disasm.h"
+#include "cfg.h"
+#include "profile.h"
+#include "verify.h"
+#include "fuzz.h"
+
+#include "drone.h"	 
+
+using namespace std;
+
+void myRandomize(const Settings & s)
+{
+	myrand((uint32)s.getSeed());
+	//srand(time(NULL));
+}
+
+void removeNewline(char *s)
+{
+	char * ptr = strchr(s,'\n');
+	if (ptr)
+		*ptr = 0;
+	ptr = strchr(s,'\r');
+	if (ptr)
+		*ptr = 0;
+}
+
+
+void printDisassembly(std::string fileToDisasm)
+{
+	Compiler c;
+	string error;
+
+	if (c.compile(fileToDisasm,error) == false)
+	{
+		printf("Error compiling source file:\n %s\n",error.c_str());
+		return;
+	}
+
+	OrganismBinary *ob = c.getProgram();
+	if (ob == NULL)
+	{
+		printf("Error compiling player file:\n program size exceeds NANORG memory size\n");
+		return;
+	}
+
+	uint16 arr[MAX_DNA] = {0};
+
+	ob->getProgram(arr);
+
+	DisAsm	d(arr,NULL);
+	char	line[DISASM_LINE_SIZE];
+
+	printf("Disassembly of %s:\n\n",fileToDisasm.c_str());
+
+	for (uint16 i=0;i<MAX_DNA;i+=INSTR_SLOTS)
+	{
+		d.formatListingLine(line,i);
+		printf("%s\n",line);
+	}
+
+	delete ob;
+}
+
+bool oneRound
+(
+	Settings &s, 
+	OrganismBinary *player, 
+	OrganismBinary *drone, 
+	double *finalScore,
+	uint16 *finalOrgs,
+	uint16 *finalDrones,
+	uint32 *finalTickNum,
+	ExecProfile *profile = NULL,
+	SpeciesLedger *cloneLedger = NULL		// --ledger in tournaments
+)
+{
+	myRandomize(s);
+
+	CConsole	*cc = new CConsole(s.getQuiet());
+	if (cc == NULL)
+		return(false);
+
+	World w(&s,cc);
+	w.setProfile(profile);
+	if (w.populateWorld(player,drone) == false)
+		return(false);
+
+	string error;
+	if (s.getResumeFile().length() > 0 && w.loadSnapshot(s.getResumeFile(),error) == false)
+	{
+		delete cc;
+		printf("Error loading snapshot:\n %s\n",error.c_str());
+		return(false);
+	}
+
+	w.run();
+	if (profile != NULL)
+		profile->addRun();
+
+	cc->clearScreen();
+	delete cc;
+
+	if (w.getError().length() > 0)
+		printf("%s\n",w.getError().c_str());
+	if (w.getTraceDropped() > 0)
+		printf("Trace: %u records dropped (see --trace-overflow)\n",w.getTraceDropped());
+	if (cloneLedger != NULL)
+	{
+		SpeciesLedger drones;
+		w.addLedgers(*cloneLedger,drones);
+	}
+	else if (s.getLedger())
+		w.printLedger(stdout);
+	if (w.getPhases() != NULL)
+		w.getPhases()->print(stdout,w.getTickNum());
+	w.printPerf(stdout);
+	w.printCycles(stdout);
+
+	if (finalScore != NULL)
+		*finalScore = w.getScore();
+	if (finalOrgs != NULL && finalDrones != NULL)
+		w.getNumAlive(finalOrgs,finalDrones);
+	if (finalTickNum != NULL)
+		*finalTickNum = w.getTickNum();
+
+	return(true);
+}
+
+OrganismBinary *getDrone(void)
+{
+	unsigned short arr[MAX_DNA];
+
+	for (int i=0;i<MAX_DNA;i++)
+		arr[i] = droneArray[i] ^ 0xBABE;
+
+	return (new OrganismBinary(arr,MAX_DNA,DRONE_STRING));
+}
+
+std::string getCommaDelimitedNumber(double number)
+{
+	char temp[256];
+	std::string result;
+	int i,j;
+
+	sprintf(temp,"%.0lf",number);
+	for (j=1,i=strlen(temp)-1;i >= 0;--i,++j)
+	{
+		result = temp[i] + result;
+		if (j % 3 == 0 && i > 0)
+			result = "," + result;
+	}
+
+	return(result);
+}
+
+bool runSingle(Settings &s)
+{
+	string error;
+
+	// if we're running a tournament then we don't want to run a single run...
+	if (s.getTournamentFile().length() > 0 || s.getSweepFile().length() > 0 ||
+		s.getSeedSelectFile().length() > 0)
+		return(false);
+	
+	if (s.getPlayerFile() == "")
+	{
+		printf("No player file specified\n");
+		return(false);
+	}
+	/*
+	if (s.getDroneFile() == "")
+	{
+		printf("No drone file specified\n");
+		return(false);
+	}
+	*/
+
+	myRandomize(s);
+
+	Compiler c;
+
+	if (c.compile(s.getPlayerFile(),error) == false)
+	{
+		printf("Error compiling player file:\n %s\n",error.c_str());
+		return(false);
+	}
+
+	OrganismBinary *playerOB = c.getProgram();
+	if (playerOB == NULL)
+	{
+		printf("Error compiling player file:\n program size exceeds NANORG memory size\n");
+		return(false);
+	}
+
+	/*
+	c.reset();
+
+	if (c.compile(s.getDroneFile(),error) == false)
+	{
+		printf("Error compiling drone file:\n %s\n",error.c_str());
+		return(false);
+	}
+	*/
+
+	// our drone is encoded internally; don't load from a file
+	OrganismBinary *droneOB = getDrone();	// c.getProgram();
+
+	CConsole	*cc = new CConsole(s.getQuiet());
+	if (cc == NULL)
+	{
+		delete playerOB;
+		delete droneOB;
+		printf("Error initializing text graphics library\n");
+		return(false);
+	}
+
+	double finalScore = 0;
+	uint32 finalTick;
+	uint16 orgs, drones;
+
+	if (oneRound(s,playerOB,droneOB,&finalScore,&orgs,&drones,&finalTick) == false)
+	{
+		delete playerOB;
+		delete droneOB;
+		return(false);
+	}
+	printf("Entrant: %s\n",playerOB->getModuleInfo().c_str());
+	printf("Your score: %s\n",getCommaDelimitedNumber(finalScore).c_str());
+	printf("Live organisms: %d, Live drones: %d, Final tick #: %d, Seed: %u\n",
+		orgs, 
+		drones, 
+		finalTick,
+		s.getSeed());
+
+	delete playerOB;
+	delete droneOB;
+
+  	return(true);
+
+}
+
+void runTrials
+(
+	Settings &s,
+	vector<uint32> &seeds,
+	OrganismBinary *droneOB,
+	OrganismBinary *playerOB,
+	vector<NANORG_RESULT> & results
+)
+{
+	s.setQuiet(true);
+
+	double finalScore = 0;
+	double totalScore = 0;
+	SpeciesLedger ledger;
+
+	for (size_t i=0;i<seeds.size();i++)
+	{
+		printf(" Evaluating %s: %lu of %lu\r",playerOB->getModuleName().c_str(),i+1,seeds.size());
+		s.setSeed(seeds[i]);
+
+		if (oneRound(s, playerOB, droneOB, &finalScore,NULL,NULL,NULL,NULL,s.getLedger() ? &ledger : NULL) == true)
+		{
+			totalScore += finalScore;
+		}
+		else
+		{
+			NANORG_RESULT	r(0,playerOB->getModuleInfo(),"Memory allocation error");
+			results.push_back(r);
+			return;
+		}
+	}
+
+	printf("\n");
+	if (s.getLedger())
+	{
+		printLedgerHeader(stdout,"");
+		printLedgerLine(stdout,"clones",ledger);
+	}
+
+	NANORG_RESULT r(totalScore,playerOB->getModuleInfo(),"");
+	results.push_back(r);
+}
+
+
+void writeResults(FILE *rstream, vector<NANORG_RESULT> & results)
+{
+	sort(results.begin(), results.end());		// sorts ascending
+
+	for(int i=results.size()-1;i>=0;--i)
+	{
+		if (results[i].result.length())
+			fprintf(rstream,"%.0lf %s (%s)\n",
+								results[i].totalScore,
+								results[i].moduleInfo.c_str(),
+								results[i].result.c_str());
+		else
+			fprintf(rstream,"%.0lf %s\n",
+								results[i].totalScore,
+								results[i].moduleInfo.c_str());
+	}
+}
+
+// Spearman rank correlation of two equally sized score lists (ties get the
+// average of their ranks)
+void getRanks(const vector<double> &scores, vector<double> &ranks)
+{
+	vector< pair<double,size_t> > sorted;
+	for (size_t i=0;i<scores.size();i++)
+		sorted.push_back(make_pair(scores[i],i));
+	sort(sorted.begin(),sorted.end());
+
+	ranks.resize(scores.size());
+	for (size_t i=0;i<sorted.size();)
+	{
+		size_t j = i;
+		while (j < sorted.size() && sorted[j].first == sorted[i].first)
+			j++;
+		for (size_t k=i;k<j;k++)
+			ranks[sorted[k].second] = (i + j - 1) / 2.0;
+		i = j;
+	}
+}
+
+double rankCorrelation(const vector<double> &a, const vector<double> &b)
+{
+	vector<double> ra, rb;
+	getRanks(a,ra);
+	getRanks(b,rb);
+
+	size_t n = ra.size();
+	if (n < 2)
+		return(1.0);
+
+	double meanA = 0, meanB = 0;
+	for (size_t i=0;i<n;i++)
+	{
+		meanA += ra[i];
+		meanB += rb[i];
+	}
+	meanA /= n;
+	meanB /= n;
+
+	double cov = 0, varA = 0, varB = 0;
+	for (size_t i=0;i<n;i++)
+	{
+		cov += (ra[i]-meanA)*(rb[i]-meanB);
+		varA += (ra[i]-meanA)*(ra[i]-meanA);
+		varB += (rb[i]-meanB)*(rb[i]-meanB);
+	}
+
+	if (varA == 0 || varB == 0)
+		return(1.0);
+	return(cov / sqrt(varA*varB));
+}
+
+// two stage tournament: every entrant is first scored over a short horizon,
+// then only the top fraction is rescored at the full iteration count.  The
+// rank correlation between the stages (over the promoted entrants) is
+// reported so the screening horizon and cut-off can be tuned.
+void runScreenedTrials
+(
+	Settings &s,
+	vector<uint32> &seeds,
+	OrganismBinary *droneOB,
+	vector<OrganismBinary *> &entrants,
+	vector<NANORG_RESULT> & results,
+	FILE *rstream
+)
+{
+	Settings screen = s;
+	screen.setMaxIterations(s.getScreenIterations());
+
+	printf("Screening %lu entrants at %u iterations...\n",
+		(unsigned long)entrants.size(),s.getScreenIterations());
+
+	vector<NANORG_RESULT> screenResults;
+	vector< pair<double,size_t> > order;
+
+	for (size_t i=0;i<entrants.size();i++)
+	{
+		runTrials(screen,seeds,droneOB,entrants[i],screenResults);
+		order.push_back(make_pair(screenResults.back().totalScore,i));
+	}
+
+	sort(order.rbegin(),order.rend());		// best first
+
+	size_t numPromoted = (entrants.size() * s.getScreenPercent() + 99) / 100;
+	if (numPromoted == 0 && entrants.size() > 0)
+		numPromoted = 1;
+
+	printf("Promoting %lu of %lu entrants to %u iterations...\n",
+		(unsigned long)numPromoted,(unsigned long)entrants.size(),s.getMaxIterations());
+
+	vector<double> shortScores, fullScores;
+
+	for (size_t i=0;i<order.size();i++)
+	{
+		size_t e = order[i].second;
+
+		if (i < numPromoted && screenResults[e].result.length() == 0)
+		{
+			runTrials(s,seeds,droneOB,entrants[e],results);
+			shortScores.push_back(screenResults[e].totalScore);
+			fullScores.push_back(results.back().totalScore);
+		}
+		else
+		{
+			char temp[256];
+			if (screenResults[e].result.length())
+				sprintf(temp,"%s",screenResults[e].result.c_str());
+			else
+				sprintf(temp,"screened out at %u iterations",s.getScreenIterations());
+			NANORG_RESULT r(screenResults[e].totalScore,screenResults[e].moduleInfo,temp);
+			results.push_back(r);
+		}
+	}
+
+	double rho = rankCorrelation(shortScores,fullScores);
+
+	printf("Screening rank correlation: %.4lf over %lu promoted entrants\n",
+		rho,(unsigned long)shortScores.size());
+	fprintf(rstream,"# screening: %u iterations, top %u%%, rank correlation %.4lf over %lu promoted entrants\n",
+		s.getScreenIterations(),s.getScreenPercent(),rho,(unsigned long)shortScores.size());
+}
+
+/* 
+format of tournament file:
+
+  results filename
+  list of seeds, one per line
+  blank line
+  drone filename.asm
+  list of asm files to test
+
+*/
+
+
+bool runTournament(Settings &s)
+{
+	// must have a tournament file
+	if (s.getTournamentFile().length() == 0)
+		return(false);
+
+	FILE *stream = fopen(s.getTournamentFile().c_str(),"rt");
+	if (stream == NULL)
+	{
+		printf("Unable to open tournament configuration file: %s\n",s.getTournamentFile().c_str());
+		return(false);
+	}
+
+	FILE	*rstream;
+	char	temp[512];
+	string	resultFile;
+
+	// get results filename
+	if (fgets(temp,511,stream) != NULL)
+	{
+		removeNewline(temp);
+		resultFile = temp;
+		rstream = fopen(temp,"wt");
+		if (rstream == NULL)
+		{
+			printf("Unable to create results file: %s\n",temp);
+			return(false);
+		}
+	}
+	else
+	{
+		fclose(stream);
+		printf("Improperly formatted tournament configuration file: %s\n",s.getTournamentFile().c_str());
+		return(false);
+	}
+
+	vector<uint32>		seeds;
+
+	while (!feof(stream))
+	{
+		if (fgets(temp,511,stream) != NULL)
+		{
+			uint32 val = (uint32)atol(temp);
+			if (val == 0)
+				break;
+			seeds.push_back(val);
+		}
+	}
+
+	if (feof(stream))
+	{
+		fclose(rstream);
+		fclose(stream);
+		printf("Missing organism filenames in tournament configuration file\n");
+		return(false);
+	}
+
+	string error;
+	OrganismBinary *droneOB, *playerOB;
+
+	// use internal encoding for drone
+	droneOB = getDrone();
+
+	/*
+	if (fgets(temp,511,stream) != NULL)
+	{
+		// got the drone filename...
+		Compiler c;
+
+		removeNewline(temp);
+
+		if (c.compile(temp,error) == false)
+		{
+			fclose(rstream);
+			printf("Error compiling drone file:\n %s\n",error.c_str());
+			return(false);
+		}
+
+		droneOB = c.getProgram();
+	}
+	*/
+
+	vector<NANORG_RESULT>		results;
+	vector<OrganismBinary *>	entrants;
+
+	printf("Running tournament...\n");
+
+	while (!feof(stream))
+	{
+		if (fgets(temp,511,stream) != NULL)
+		{
+			// got the first competitor filename...
+			Compiler c;
+
+			removeNewline(temp);
+
+			if (strlen(temp) == 0)
+				continue;
+
+			if (c.compile(temp,error) == false)
+			{
+				NANORG_RESULT	r(0,temp,error);
+				results.push_back(r);
+				printf(" Evaluating %s: Error (%s)\n",temp,error.c_str());
+				continue;
+			}
+
+			playerOB = c.getProgram();
+			if (playerOB == NULL)
+			{
+				NANORG_RESULT	r(0,temp,"program size exceeds NANORG memory size");
+				results.push_back(r);
+				printf(" Evaluating %s: Error (program size exceeds NANORG memory size)\n",temp);
+				continue;
+			}
+ 
+			entrants.push_back(playerOB);
+		}
+	}
+
+	if (s.getScreenIterations() == 0)
+	{
+		for (size_t i=0;i<entrants.size();i++)
+			runTrials(s,seeds,droneOB,entrants[i],results);
+	}
+	else
+		runScreenedTrials(s,seeds,droneOB,entrants,results,rstream);
+
+	printf("Writing results to %s...\n",resultFile.c_str());
+
+	writeResults(rstream,results);
+
+	for (size_t i=0;i<entrants.size();i++)
+		delete entrants[i];
+	delete droneOB;
+
+	fclose(rstream);
+	fclose(stream);
+
+	return(true);
+}
+
+
+/* 
+format of sweep file:
+
+  results filename
+  list of seeds, one per line
+  blank line
+  organism filename.asm
+  one line per {{PARAMETER}}: NAME value1 value2 ...
+
+every combination of parameter values is evaluated against every seed; the
+organism is compiled once and each variant is produced by patching the
+parameter slots recorded in its OrganismBinary
+*/
+
+// runs every (player, seed) pair on a pool of worker threads; scores come back
+// player-major: scores[player * seeds.size() + seed]
+
+struct TrialBatch
+{
+	Settings					*settings;
+	OrganismBinary				*drone;
+	vector<OrganismBinary *>	*players;
+	vector<uint32>				*seeds;
+	vector<double>				*scores;
+	const char					*label;
+	std::atomic<size_t>			nextTrial;
+	std::atomic<size_t>			trialsDone;
+	std::mutex					printLock;
+};
+
+void trialWorker(TrialBatch *batch)
+{
+	size_t numTrials = batch->scores->size();
+	size_t numSeeds = batch->seeds->size();
+
+	for (;;)
+	{
+		size_t trial = batch->nextTrial++;
+		if (trial >= numTrials)
+			break;
+
+		Settings s = *batch->settings;
+		s.setQuiet(true);
+		s.setSeed((*batch->seeds)[trial % numSeeds]);
+
+		double finalScore = 0;
+		oneRound(s,(*batch->players)[trial / numSeeds],batch->drone,&finalScore,NULL,NULL,NULL);
+		(*batch->scores)[trial] = finalScore;
+
+		size_t done = ++batch->trialsDone;
+		std::lock_guard<std::mutex> lock(batch->printLock);
+		printf(" Evaluating %s: %lu of %lu trials\r",batch->label,(unsigned long)done,(unsigned long)numTrials);
+		fflush(stdout);
+	}
+}
+
+void runParallelTrials
+(
+	Settings &s,
+	OrganismBinary *droneOB,
+	vector<OrganismBinary *> &players,
+	vector<uint32> &seeds,
+	vector<double> &scores,
+	const char *label
+)
+{
+	TrialBatch batch;
+
+	batch.settings = &s;
+	batch.drone = droneOB;
+	batch.players = &players;
+	batch.seeds = &seeds;
+	batch.scores = &scores;
+	batch.label = label;
+	batch.nextTrial = 0;
+	batch.trialsDone = 0;
+
+	scores.assign(players.size() * seeds.size(),0);
+
+	unsigned int numThreads = s.getNumThreads();
+	if (numThreads == 0)
+		numThreads = std::thread::hardware_concurrency();
+	if (numThreads == 0)
+		numThreads = 1;
+
+	vector<std::thread> workers;
+	for (unsigned int i=0;i<numThreads;i++)
+		workers.push_back(std::thread(trialWorker,&batch));
+	for (unsigned int i=0;i<numThreads;i++)
+		workers[i].join();
+
+	printf("\n");
+}
+
+// decode a combination index into one value per parameter (mixed radix)
+void getSweepValues
+(
+	vector< vector<uint16> > &paramValues, 
+	size_t combo, 
+	vector<uint16> &values
+)
+{
+	values.resize(paramValues.size());
+	for (int i=(int)paramValues.size()-1;i>=0;--i)
+	{
+		values[i] = paramValues[i][combo % paramValues[i].size()];
+		combo /= paramValues[i].size();
+	}
+}
+
+bool runSweep(Settings &s)
+{
+	if (s.getSweepFile().length() == 0)
+		return(false);
+
+	FILE *stream = fopen(s.getSweepFile().c_str(),"rt");
+	if (stream == NULL)
+	{
+		printf("Unable to open sweep configuration file: %s\n",s.getSweepFile().c_str());
+		return(false);
+	}
+
+	char	temp[512];
+	string	resultFile;
+
+	if (fgets(temp,511,stream) == NULL)
+	{
+		fclose(stream);
+		printf("Improperly formatted sweep configuration file: %s\n",s.getSweepFile().c_str());
+		return(false);
+	}
+	removeNewline(temp);
+	resultFile = temp;
+
+	vector<uint32>				seeds;
+	vector<string>				names;
+	vector< vector<uint16> >	paramValues;
+
+	while (!feof(stream))
+	{
+		if (fgets(temp,511,stream) != NULL)
+		{
+			uint32 val = (uint32)atol(temp);
+			if (val == 0)
+				break;
+			seeds.push_back(val);
+		}
+	}
+
+	if (seeds.size() == 0 || fgets(temp,511,stream) == NULL)
+	{
+		fclose(stream);
+		printf("Missing seeds or organism filename in sweep configuration file\n");
+		return(false);
+	}
+
+	removeNewline(temp);
+
+	Compiler c;
+	string error;
+
+	if (c.compile(temp,error) == false)
+	{
+		fclose(stream);
+		printf("Error compiling player file:\n %s\n",error.c_str());
+		return(false);
+	}
+
+	OrganismBinary *playerOB = c.getProgram();
+	if (playerOB == NULL)
+	{
+		fclose(stream);
+		printf("Error compiling player file:\n program size exceeds NANORG memory size\n");
+		return(false);
+	}
+
+	size_t numCombos = 1;
+
+	while (fgets(temp,511,stream) != NULL)
+	{
+		removeNewline(temp);
+		_strupr(temp);
+
+		char *tok = strtok(temp," \t,");
+		if (tok == NULL)
+			continue;
+
+		if (playerOB->hasParameter(tok) == false)
+		{
+			fclose(stream);
+			printf("Unknown parameter {{%s}} in sweep configuration file\n",tok);
+			delete playerOB;
+			return(false);
+		}
+
+		names.push_back(tok);
+		paramValues.push_back(vector<uint16>());
+
+		while ((tok = strtok(NULL," \t,")) != NULL)
+		{
+			unsigned long val = strtoul(tok,NULL,0);
+			if (val > MAX_WORD_VALUE)
+			{
+				fclose(stream);
+				printf("Invalid value %s for parameter {{%s}}\n",tok,names.back().c_str());
+				delete playerOB;
+				return(false);
+			}
+			paramValues.back().push_back((uint16)val);
+		}
+
+		if (paramValues.back().size() == 0)
+		{
+			fclose(stream);
+			printf("No values given for parameter {{%s}}\n",names.back().c_str());
+			delete playerOB;
+			return(false);
+		}
+
+		numCombos *= paramValues.back().size();
+	}
+
+	fclose(stream);
+
+	FILE *rstream = fopen(resultFile.c_str(),"wt");
+	if (rstream == NULL)
+	{
+		printf("Unable to create results file: %s\n",resultFile.c_str());
+		delete playerOB;
+		return(false);
+	}
+
+	// patch one variant per combination; nothing is recompiled
+	vector<OrganismBinary *>	variants;
+	vector<uint16>				values;
+
+	for (size_t combo=0;combo<numCombos;combo++)
+	{
+		OrganismBinary *variant = new OrganismBinary(*playerOB);
+		getSweepValues(paramValues,combo,values);
+		for (size_t i=0;i<values.size();i++)
+			variant->setParameter(names[i],values[i]);
+		variants.push_back(variant);
+	}
+
+	printf("Running sweep of %lu combinations over %lu seeds...\n",
+		(unsigned long)numCombos,(unsigned long)seeds.size());
+
+	OrganismBinary *droneOB = getDrone();
+	vector<double> scores;
+
+	runParallelTrials(s,droneOB,variants,seeds,scores,"sweep");
+
+	vector<NANORG_RESULT>	results;
+
+	for (size_t combo=0;combo<numCombos;combo++)
+	{
+		double totalScore = 0;
+		for (size_t j=0;j<seeds.size();j++)
+			totalScore += scores[combo * seeds.size() + j];
+
+		string info = playerOB->getModuleInfo() + " [";
+		getSweepValues(paramValues,combo,values);
+		for (size_t i=0;i<values.size();i++)
+		{
+			sprintf(temp,"%s%s=%u",i ? " " : "",names[i].c_str(),values[i]);
+			info += temp;
+		}
+		info += "]";
+
+		NANORG_RESULT r(totalScore,info,"");
+		results.push_back(r);
+
+		delete variants[combo];
+	}
+
+	printf("Writing results to %s...\n",resultFile.c_str());
+
+	writeResults(rstream,results);
+
+	fclose(rstream);
+	delete droneOB;
+	delete playerOB;
+
+	return(true);
+}
+
+/*
+format of seed selection file:
+
+  output filename (receives the chosen seeds, one per line)
+  pool of candidate seeds, one per line
+  blank line
+  list of asm files forming the reference corpus
+
+each pool seed's world is generated to measure its features; seeds are then
+stratified on those features and the smallest subset whose ranking of the
+corpus agrees with the full pool (Spearman rho >= 1 - tolerance) is kept
+*/
+
+void getSeedFeatures
+(
+	Settings &s, 
+	uint32 seed, 
+	OrganismBinary *player, 
+	OrganismBinary *drone, 
+	double features[SEED_FEATURES]
+)
+{
+	Settings ws = s;
+	ws.setQuiet(true);
+	ws.setSeed(seed);
+	myRandomize(ws);
+
+	CConsole cc(true);
+	World w(&ws,&cc);
+	w.populateWorld(player,drone);
+
+	WorldFeatures f;
+	w.getFeatures(f);
+
+	features[0] = f.numFoodIDs;
+	features[1] = f.poisonRatio;
+	features[2] = f.collectionDispersion;
+	features[3] = f.droneProximity;
+}
+
+// choose count seeds: one stratum per above/below-median combination of the
+// features, quotas proportional to stratum size (largest remainder), and the
+// seeds closest to each stratum's centroid first
+void selectStratified
+(
+	vector<int> &stratum, 
+	vector< vector<size_t> > &byCentrality, 
+	size_t count, 
+	vector<size_t> &chosen
+)
+{
+	size_t numStrata = byCentrality.size(), total = stratum.size(), given = 0;
+	vector<size_t> quota(numStrata);
+	vector< pair<double,size_t> > remainders;
+
+	for (size_t i=0;i<numStrata;i++)
+	{
+		double exact = (double)count * byCentrality[i].size() / total;
+		quota[i] = (size_t)exact;
+		given += quota[i];
+		remainders.push_back(make_pair(exact - quota[i],i));
+	}
+
+	sort(remainders.rbegin(),remainders.rend());
+	for (size_t i=0;given < count && i < remainders.size();i++)
+	{
+		size_t st = remainders[i].second;
+		if (quota[st] < byCentrality[st].size())
+		{
+			++quota[st];
+			++given;
+		}
+	}
+
+	chosen.clear();
+	for (size_t i=0;i<numStrata;i++)
+		for (size_t j=0;j<quota[i];j++)
+			chosen.push_back(byCentrality[i][j]);
+}
+
+bool runSeedSelection(Settings &s)
+{
+	if (s.getSeedSelectFile().length() == 0)
+		return(false);
+
+	FILE *stream = fopen(s.getSeedSelectFile().c_str(),"rt");
+	if (stream == NULL)
+	{
+		printf("Unable to open seed selection file: %s\n",s.getSeedSelectFile().c_str());
+		return(false);
+	}
+
+	char	temp[512];
+	string	outFile, error;
+
+	if (fgets(temp,511,stream) == NULL)
+	{
+		fclose(stream);
+		printf("Improperly formatted seed selection file: %s\n",s.getSeedSelectFile().c_str());
+		return(false);
+	}
+	removeNewline(temp);
+	outFile = temp;
+
+	vector<uint32> seeds;
+
+	while (fgets(temp,511,stream) != NULL)
+	{
+		uint32 val = (uint32)atol(temp);
+		if (val == 0)
+			break;
+		seeds.push_back(val);
+	}
+
+	vector<OrganismBinary *> corpus;
+
+	while (fgets(temp,511,stream) != NULL)
+	{
+		removeNewline(temp);
+		if (strlen(temp) == 0)
+			continue;
+
+		Compiler c;
+		if (c.compile(temp,error) == false)
+		{
+			printf(" Skipping %s: Error (%s)\n",temp,error.c_str());
+			continue;
+		}
+
+		OrganismBinary *ob = c.getProgram();
+		if (ob == NULL)
+		{
+			printf(" Skipping %s: Error (program size exceeds NANORG memory size)\n",temp);
+			continue;
+		}
+		corpus.push_back(ob);
+	}
+
+	fclose(stream);
+
+	if (seeds.size() < 2 || corpus.size() < 2)
+	{
+		printf("Seed selection needs at least 2 seeds and 2 valid organisms\n");
+		for (size_t i=0;i<corpus.size();i++)
+			delete corpus[i];
+		return(false);
+	}
+
+	OrganismBinary *droneOB = getDrone();
+	size_t n = seeds.size(), i, j, f;
+
+	// measure every world in the pool
+
+	printf("Measuring %lu worlds...\n",(unsigned long)n);
+
+	vector< vector<double> > features(n,vector<double>(SEED_FEATURES));
+	for (i=0;i<n;i++)
+		getSeedFeatures(s,seeds[i],corpus[0],droneOB,&features[i][0]);
+
+	// stratify: one bit per feature for above/below the pool median
+
+	vector<int> stratum(n,0);
+	vector<double> mean(SEED_FEATURES,0), spread(SEED_FEATURES,0);
+
+	for (f=0;f<SEED_FEATURES;f++)
+	{
+		vector<double> column;
+		for (i=0;i<n;i++)
+			column.push_back(features[i][f]);
+		sort(column.begin(),column.end());
+		double median = column[n/2];
+
+		for (i=0;i<n;i++)
+		{
+			if (features[i][f] > median)
+				stratum[i] |= 1 << f;
+			mean[f] += features[i][f] / n;
+		}
+		for (i=0;i<n;i++)
+			spread[f] += (features[i][f]-mean[f])*(features[i][f]-mean[f]) / n;
+		spread[f] = spread[f] > 0 ? sqrt(spread[f]) : 1;
+	}
+
+	vector< vector<size_t> > byCentrality(1 << SEED_FEATURES);
+	vector< vector<double> > centroid(1 << SEED_FEATURES,vector<double>(SEED_FEATURES,0));
+
+	for (i=0;i<n;i++)
+		byCentrality[stratum[i]].push_back(i);
+
+	for (size_t st=0;st<byCentrality.size();st++)
+	{
+		vector<size_t> &members = byCentrality[st];
+		vector< pair<double,size_t> > dist;
+
+		for (j=0;j<members.size();j++)
+			for (f=0;f<SEED_FEATURES;f++)
+				centroid[st][f] += features[members[j]][f] / members.size();
+
+		for (j=0;j<members.size();j++)
+		{
+			double d = 0;
+			for (f=0;f<SEED_FEATURES;f++)
+			{
+				double z = (features[members[j]][f] - centroid[st][f]) / spread[f];
+				d += z*z;
+			}
+			dist.push_back(make_pair(d,members[j]));
+		}
+
+		sort(dist.begin(),dist.end());
+		for (j=0;j<members.size();j++)
+			members[j] = dist[j].second;
+	}
+
+	// score the reference corpus over the whole pool once
+
+	vector<double> scores;
+	runParallelTrials(s,droneOB,corpus,seeds,scores,"reference corpus");
+
+	vector<double> fullTotals(corpus.size(),0);
+	for (i=0;i<corpus.size();i++)
+		for (j=0;j<n;j++)
+			fullTotals[i] += scores[i*n + j];
+
+	// grow the subset until it ranks the corpus like the full pool does
+
+	vector<size_t> chosen;
+	double rho = 1.0;
+	size_t count;
+
+	for (count=1;count<=n;count++)
+	{
+		selectStratified(stratum,byCentrality,count,chosen);
+
+		vector<double> subTotals(corpus.size(),0);
+		for (i=0;i<corpus.size();i++)
+			for (j=0;j<chosen.size();j++)
+				subTotals[i] += scores[i*n + chosen[j]];
+
+		rho = rankCorrelation(subTotals,fullTotals);
+		if (rho >= 1.0 - s.getSeedTolerance())
+			break;
+	}
+
+	FILE *ostream = fopen(outFile.c_str(),"wt");
+	if (ostream == NULL)
+	{
+		printf("Unable to create seed file: %s\n",outFile.c_str());
+	}
+	else
+	{
+		printf("Selected %lu of %lu seeds (rank correlation %.4lf):\n",
+			(unsigned long)chosen.size(),(unsigned long)n,rho);
+		printf("  seed        food IDs  poison  dispersion  drone dist\n");
+
+		sort(chosen.begin(),chosen.end());
+		for (j=0;j<chosen.size();j++)
+		{
+			vector<double> &ft = features[chosen[j]];
+			fprintf(ostream,"%u\n",seeds[chosen[j]]);
+			printf("  %-10u  %8.0lf  %6.3lf  %10.2lf  %10.2lf\n",
+				seeds[chosen[j]],ft[0],ft[1],ft[2],ft[3]);
+		}
+		fclose(ostream);
+	}
+
+	for (i=0;i<corpus.size();i++)
+		delete corpus[i];
+	delete droneOB;
+
+	return(ostream != NULL);
+}
+
+bool printDisassembly(const Settings &s)
+{
+	if (s.getPrintFile().length() > 0)
+	{
+		printDisassembly(s.getPrintFile());
+		return(true);
+	}
+	return(false);
+}
+
+// --profile/--flame: run the entrant over consecutive seeds from -s and
+// report where its instructions and energy went, by source line and/or by
+// call stack
+
+bool runProfile(Settings &s)
+{
+	if (s.getProfileFile().length() == 0 && s.getFlameFile().length() == 0)
+		return(false);
+
+	Compiler c;
+	string error;
+
+	if (c.compile(s.getPlayerFile(),error) == false)
+	{
+		printf("Error compiling player file:\n %s\n",error.c_str());
+		return(true);
+	}
+
+	OrganismBinary *playerOB = c.getProgram();
+	if (playerOB == NULL)
+	{
+		printf("Error compiling player file:\n program size exceeds NANORG memory size\n");
+		return(true);
+	}
+
+	OrganismBinary *droneOB = getDrone();
+	ExecProfile *profile = new ExecProfile(s.getFlameFile().length() > 0);
+	uint32 firstSeed = s.getSeed();
+	double totalScore = 0, finalScore;
+
+	s.setQuiet(true);
+	for (uint32 i=0;i<s.getProfileRuns();i++)
+	{
+		s.setSeed(firstSeed+i);
+		if (oneRound(s,playerOB,droneOB,&finalScore,NULL,NULL,NULL,profile) == false)
+			break;
+		printf("Seed %u: %s\n",s.getSeed(),getCommaDelimitedNumber(finalScore).c_str());
+		totalScore += finalScore;
+	}
+	printf("Total score: %s\n",getCommaDelimitedNumber(totalScore).c_str());
+
+	if (s.getProfileFile().length() > 0)
+	{
+		if (profile->writeAnnotated(s.getProfileFile(),playerOB,error) == false)
+			printf("Error writing profile:\n %s\n",error.c_str());
+		else
+			printf("Profile written to %s\n",s.getProfileFile().c_str());
+	}
+
+	// ticks to the named file, energy alongside it
+	if (s.getFlameFile().length() > 0)
+	{
+		string energyFile = s.getFlameFile() + ".energy";
+		if (profile->writeFolded(s.getFlameFile(),false,playerOB,error) == false ||
+			profile->writeFolded(energyFile,true,playerOB,error) == false)
+			printf("Error writing call stacks:\n %s\n",error.c_str());
+		else
+			printf("Call stacks written to %s and %s\n",s.getFlameFile().c_str(),energyFile.c_str());
+	}
+
+	delete profile;
+	delete playerOB;
+	delete droneOB;
+	return(true);
+}
+
+/*
+format of the benchmark file (bench/bench.txt, run by make bench):
+
+  JSON results filename
+  list of seeds, one per line
+  blank line
+  organism filename.asm, or "drone" for the built-in drone, one per line
+
+each entrant plays every seed quietly for -i ticks.  Results go out one
+entrant per line so a later run can read them back as its baseline: an
+entrant regresses when its instructions/sec drop by more than
+DEFAULT_BENCH_TOLERANCE, or when its score changes at the same tick count.
+*/
+
+struct BenchResult
+{
+	string	name;
+	uint32	trials;
+	uint64	instructions;
+	uint64	ticks;
+	double	score;
+	double	setupSeconds;		// World construction and population
+	double	runSeconds;			// World::run
+};
+
+// the value following "key": on the line of a previous result, or -1
+
+double getBenchValue(const string &line, const char *key)
+{
+	string pattern = string("\"") + key + "\": ";
+	size_t off = line.find(pattern);
+	if (off == string::npos)
+		return(-1);
+	return(atof(line.c_str() + off + pattern.length()));
+}
+
+bool benchTrial(Settings &s, OrganismBinary *player, OrganismBinary *drone, BenchResult &r)
+{
+	myRandomize(s);
+
+	CConsole cc(true);
+	uint64 start = PhaseProfile::now();
+
+	World w(&s,&cc);
+	if (w.populateWorld(player,drone) == false)
+		return(false);
+
+	uint64 populated = PhaseProfile::now();
+	w.run();
+	uint64 done = PhaseProfile::now();
+
+	r.trials++;
+	r.instructions += w.getInstructions();
+	r.ticks += w.getRunTicks();
+	r.score += w.getScore();
+	r.setupSeconds += (populated - start) / 1e9;
+	r.runSeconds += (done - populated) / 1e9;
+	return(true);
+}
+
+bool runBench(Settings &s)
+{
+	if (s.getBenchFile().length() == 0)
+		return(false);
+
+	FILE *stream = fopen(s.getBenchFile().c_str(),"rt");
+	if (stream == NULL)
+	{
+		printf("Unable to open benchmark file: %s\n",s.getBenchFile().c_str());
+		return(false);
+	}
+
+	char	temp[512];
+	string	outFile, error;
+
+	if (fgets(temp,511,stream) == NULL)
+	{
+		fclose(stream);
+		printf("Improperly formatted benchmark file: %s\n",s.getBenchFile().c_str());
+		return(false);
+	}
+	removeNewline(temp);
+	outFile = temp;
+
+	vector<uint32> seeds;
+
+	while (fgets(temp,511,stream) != NULL)
+	{
+		uint32 val = (uint32)atol(temp);
+		if (val == 0)
+			break;
+		seeds.push_back(val);
+	}
+
+	OrganismBinary *droneOB = getDrone();
+	vector<BenchResult> results;
+	bool ok = true;
+
+	s.setQuiet(true);
+
+	while (ok && fgets(temp,511,stream) != NULL)
+	{
+		removeNewline(temp);
+		if (strlen(temp) == 0)
+			continue;
+
+		OrganismBinary *playerOB = NULL;
+		BenchResult r;
+
+		if (strcmp(temp,DRONE_STRING) == 0)
+		{
+			playerOB = getDrone();
+			r.name = DRONE_STRING;
+		}
+		else
+		{
+			Compiler c;
+			if (c.compile(temp,error) == false || (playerOB = c.getProgram()) == NULL)
+			{
+				printf("Error compiling %s:\n %s\n",temp,error.length() ? error.c_str() : "program size exceeds NANORG memory size");
+				ok = false;
+				break;
+			}
+
+			r.name = temp;
+			size_t slash = r.name.find_last_of("/\\");
+			if (slash != string::npos)
+				r.name = r.name.substr(slash+1);
+			if (r.name.length() > 4 && r.name.substr(r.name.length()-4) == ".asm")
+				r.name = r.name.substr(0,r.name.length()-4);
+		}
+
+		r.trials = 0;
+		r.instructions = r.ticks = 0;
+		r.score = r.setupSeconds = r.runSeconds = 0;
+
+		for (size_t i=0;i<seeds.size() && ok;i++)
+		{
+			printf(" Benchmarking %s: %lu of %lu\r",r.name.c_str(),(unsigned long)i+1,(unsigned long)seeds.size());
+			fflush(stdout);
+			s.setSeed(seeds[i]);
+			ok = benchTrial(s,playerOB,droneOB,r);
+		}
+		printf("\n");
+
+		results.push_back(r);
+		delete playerOB;
+	}
+
+	fclose(stream);
+	delete droneOB;
+
+	if (ok == false || results.size() == 0 || seeds.size() == 0)
+	{
+		printf("Benchmark needs at least one seed and one entrant that runs\n");
+		return(false);
+	}
+
+	// read the baseline before the results can overwrite it
+
+	vector<string> baseline;
+	if (s.getBenchBaseline().length() > 0)
+	{
+		FILE *bstream = fopen(s.getBenchBaseline().c_str(),"rt");
+		if (bstream == NULL)
+		{
+			printf("Unable to open benchmark baseline: %s\n",s.getBenchBaseline().c_str());
+			return(false);
+		}
+		while (fgets(temp,511,bstream) != NULL)
+			baseline.push_back(temp);
+		fclose(bstream);
+	}
+
+	FILE *rstream = fopen(outFile.c_str(),"wt");
+	if (rstream == NULL)
+	{
+		printf("Unable to create benchmark results file: %s\n",outFile.c_str());
+		return(false);
+	}
+
+	BenchResult total;
+	total.name = "total";
+	total.trials = 0;
+	total.instructions = total.ticks = 0;
+	total.score = total.setupSeconds = total.runSeconds = 0;
+
+	fprintf(rstream,"{\n\t\"iterations\": %u,\n\t\"seeds\": [",s.getMaxIterations());
+	for (size_t i=0;i<seeds.size();i++)
+		fprintf(rstream,"%s%u",i ? ", " : "",seeds[i]);
+	fprintf(rstream,"],\n\t\"entrants\": [\n");
+
+	for (size_t i=0;i<=results.size();i++)
+	{
+		BenchResult &r = (i < results.size()) ? results[i] : total;
+		if (i < results.size())
+		{
+			total.trials += r.trials;
+			total.instructions += r.instructions;
+			total.ticks += r.ticks;
+			total.score += r.score;
+			total.setupSeconds += r.setupSeconds;
+			total.runSeconds += r.runSeconds;
+		}
+		else
+			fprintf(rstream,"\t],\n\t\"total\":\n");
+
+		fprintf(rstream,"\t\t{ \"name\": \"%s\", \"trials\": %u, \"instructions\": %llu, \"ticks\": %llu, "
+			"\"score\": %.0f, \"setup_ms\": %.3f, \"run_s\": %.3f, \"instr_per_sec\": %.0f, \"ticks_per_sec\": %.0f }%s\n",
+			r.name.c_str(),
+			r.trials,
+			(unsigned long long)r.instructions,
+			(unsigned long long)r.ticks,
+			r.score,
+			r.setupSeconds * 1000 / r.trials,
+			r.runSeconds,
+			r.runSeconds > 0 ? r.instructions / r.runSeconds : 0.0,
+			r.runSeconds > 0 ? r.ticks / r.runSeconds : 0.0,
+			(i + 1 < results.size()) ? "," : "");
+	}
+	fprintf(rstream,"}\n");
+	fclose(rstream);
+
+	// console summary, compared with the baseline where there is one
+
+	double baseIterations = -1;
+	for (size_t j=0;j<baseline.size() && baseIterations < 0;j++)
+		baseIterations = getBenchValue(baseline[j],"iterations");
+
+	uint32 regressions = 0;
+
+	printf("%-12s %14s %12s %10s %10s\n","entrant","instr/sec","ticks/sec","setup ms","baseline");
+	for (size_t i=0;i<=results.size();i++)
+	{
+		BenchResult &r = (i < results.size()) ? results[i] : total;
+		double ips = r.runSeconds > 0 ? r.instructions / r.runSeconds : 0;
+
+		printf("%-12s %14.0f %12.0f %10.3f",r.name.c_str(),ips,
+			r.runSeconds > 0 ? r.ticks / r.runSeconds : 0.0,r.setupSeconds * 1000 / r.trials);
+
+		string key = "\"name\": \"" + r.name + "\"";
+		size_t j;
+		for (j=0;j<baseline.size() && baseline[j].find(key) == string::npos;j++)
+			;
+		if (j == baseline.size())
+		{
+			printf("\n");
+			continue;
+		}
+
+		double baseIps = getBenchValue(baseline[j],"instr_per_sec");
+		double baseScore = getBenchValue(baseline[j],"score");
+		bool slower = baseIps > 0 && ips < baseIps * (1 - DEFAULT_BENCH_TOLERANCE);
+		bool changed = baseIterations == s.getMaxIterations() && baseScore >= 0 &&
+			getCommaDelimitedNumber(baseScore) != getCommaDelimitedNumber(r.score);
+
+		printf(" %+9.1f%%%s%s\n",baseIps > 0 ? (ips / baseIps - 1) * 100 : 0.0,
+			slower ? "  SLOWER" : "",changed ? "  SCORE CHANGED" : "");
+		if (slower || changed)
+			regressions++;
+	}
+
+	printf("Results written to %s\n",outFile.c_str());
+	if (regressions > 0)
+	{
+		printf("%u regression(s) against %s\n",regressions,s.getBenchBaseline().c_str());
+		return(false);
+	}
+
+	return(true);
+}
+
+// --verify: the candidate engine must match the reference on every seed
+
+bool runVerify(Settings &s)
+{
+	int engine = findEngine(s.getVerifyEngine());
+	if (engine < 0)
+	{
+		printf("Unknown engine: %s\n",s.getVerifyEngine().c_str());
+		return(false);
+	}
+
+	Compiler c;
+	string error;
+
+	if (c.compile(s.getPlayerFile(),error) == false)
+	{
+		printf("Error compiling player file:\n %s\n",error.c_str());
+		return(false);
+	}
+
+	OrganismBinary *playerOB = c.getProgram();
+	if (playerOB == NULL)
+	{
+		printf("Error compiling player file:\n program size exceeds NANORG memory size\n");
+		return(false);
+	}
+
+	OrganismBinary *droneOB = getDrone();
+	uint32 firstSeed = s.getSeed(), failed = 0;
+
+	s.setQuiet(true);
+	for (uint32 i=0;i<s.getVerifyRuns();i++)
+	{
+		s.setSeed(firstSeed+i);
+		if (verifyEngine(s,playerOB,droneOB,engine,stdout) == true)
+			printf("Seed %u: %s matches %s\n",s.getSeed(),getEngineName(engine),getEngineName(ENGINE_SWITCH));
+		else
+			failed++;
+	}
+
+	if (failed > 0)
+		printf("%u of %u seeds diverged\n",failed,s.getVerifyRuns());
+
+	delete playerOB;
+	delete droneOB;
+	return(failed == 0);
+}
+
+// --fuzz: mutated images through every engine and the assembler
+
+bool runFuzz(Settings &s)
+{
+	OrganismBinary *playerOB = NULL;
+
+	if (s.getPlayerFile().length() > 0)
+	{
+		Compiler c;
+		string error;
+
+		if (c.compile(s.getPlayerFile(),error) == false)
+		{
+			printf("Error compiling player file:\n %s\n",error.c_str());
+			return(false);
+		}
+
+		playerOB = c.getProgram();
+		if (playerOB == NULL)
+		{
+			printf("Error compiling player file:\n program size exceeds NANORG memory size\n");
+			return(false);
+		}
+	}
+
+	OrganismBinary *droneOB = getDrone();
+	bool passed = fuzzEngines(s,playerOB,droneOB,stdout);
+
+	if (playerOB != NULL)
+		delete playerOB;
+	delete droneOB;
+	return(passed);
+}
+
+bool printControlFlow(const Settings &s)
+{
+	if (s.getCfgFile().length() == 0)
+		return(false);
+
+	Compiler c;
+	string error;
+
+	if (c.compile(s.getCfgFile(),error) == false)
+	{
+		printf("Error compiling source file:\n %s\n",error.c_str());
+		return(true);
+	}
+
+	OrganismBinary *ob = c.getProgram();
+	if (ob == NULL)
+	{
+		printf("Error compiling player file:\n program size exceeds NANORG memory size\n");
+		return(true);
+	}
+
+	uint16 arr[MAX_DNA] = {0};
+	ob->getProgram(arr);
+
+	ControlFlowGraph cfg(arr,ob->getProgramSize());
+	cfg.printReport(stdout,s.getCfgFile());
+
+	if (s.getCfgDotFile().length() > 0 && cfg.writeDot(s.getCfgDotFile(),error) == false)
+		printf("Error writing graph:\n %s\n",error.c_str());
+
+	delete ob;
+	return(true);
+}
+
+bool decodeTrace(const Settings &s)
+{
+	if (s.getDecodeTraceFile().length() == 0)
+		return(false);
+
+	// --trace-ticks and --trace-orgs pick what to show
+	TraceQuery query;
+	query.firstTick = s.getTraceFirstTick();
+	query.lastTick = s.getTraceLastTick();
+	if (s.getTraceOrgsSet())
+		for (uint16 i=0;i<MAX_TRACE_ORGS;i++)
+			query.orgs[i] = s.getTraceOrg(i);
+
+	string error;
+	if (decodeTrace(s.getDecodeTraceFile(),stdout,query,error) == false)
+		printf("Error decoding trace:\n %s\n",error.c_str());
+	return(true);
+}
+
+int main(int argc, char *argv[])
+{
+	Settings s;
+	string error;
+	
+	if (s.LoadSettings(argc,argv,error) == false)
+	{
+		printf("Error loading settings:\n %s\n",error.c_str());
+		return(-1);
+	}
+
+	if (printDisassembly(s) == true)
+	{
+		return(0);
+	}
+
+	if (printControlFlow(s) == true)
+	{
+		return(0);
+	}
+
+	if (decodeTrace(s) == true)
+	{
+		return(0);
+	}
+
+	if (runProfile(s) == true)
+	{
+		return(0);
+	}
+
+	if (s.getVerifyRuns() > 0)
+	{
+		return(runVerify(s) ? 0 : -1);
+	}
+
+	if (s.getFuzzCases() > 0)
+	{
+		return(runFuzz(s) ? 0 : -1);
+	}
+
+	if (s.getBenchFile().length() > 0)
+	{
+		return(runBench(s) ? 0 : -1);
+	}
+
+	if (runSingle(s) == true)
+	{
+		return(0);
+	}
+
+	if (runTournament(s) == true)
+	{
+		return(0);
+	}
+
+	if (runSweep(s) == true)
+	{
+		return(0);
+	}
+
+	if (runSeedSelection(s) == true)
+	{
+		return(0);
+	}
+
+	// must have been an error
+  	return(-1);
+}
+
+// when using -q, show final map status at the end
+// highlight debug char in special color
@@ -1,77 +1,82 @@
-//----------------------------------------------------------------------------
-//
-// disasm.h
-//
-//----------------------------------------------------------------------------
-//
-// Copyright (c) 2006, Symantec Corporation All rights reserved.
-//
-// Redistribution and use in source and binary forms, with or without
-// modification, are permitted provided that the following conditions are
-// met:
-//
-// -  Redistributions of source code must retain the above copyright notice,
-// this list of conditions and the following disclaimer. 
-//
-// -  Redistributions in binary form must reproduce the above copyright
-// notice, this list of conditions and the following disclaimer in the
-// documentation and/or other materials provided with the distribution. 
-//
-// - Neither the name of Symantec Corp. nor the names of its contributors
-// may be used to endorse or promote products derived from this software
-// without specific prior written permission. 
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
-// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
-// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
-// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-//
-
-#ifndef _DISASM_H_
-
-#define _DISASM_H_
-
-#include "types.h"
-#include "compiler.h"
-#include "constants.h"
-
-#include <string>
-
-class DisAsm
-{
-public:
-	DisAsm(uint16 *dna,uint16 *regs)
-	{
-		m_dna = dna;		// points to MAX_DNA sized array
-		m_regs = regs;
-	}
-
-	void getDisassembly(std::vector<std::string> &disasm, uint16 start, uint16 end);
-	std::string getCurrentLine(uint16 start)
-	{
-		while (start % INSTR_SLOTS != 0)
-			start++; 
-
-		char temp[256];
-		sprintf(temp,"%04d  %s",start,getCurrentInstructionString(start,true).c_str());
-		return(temp);
-	}
-
-private:
-	std::string getRegString(int regNum);
-	std::string getOperandString(int instrLocation, int opNum, std::string &value, bool relative);
-	std::string getCurrentInstructionString(int location, bool appendValues);
-	
-private:
-	uint16 *m_dna;
-	uint16 *m_regs;
-};
-
-#endif //  #ifndef _DISASM_H_
+//----------------------------------------------------------------------------
+//
+// disasm.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer. 
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution. 
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission. 
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef _DISASM_H_
+
+#define _DISASM_H_
+
+#include "types.h"
+#include "compiler.h"
+#include "constants.h"
+
+#include <string>
+
+#define DISASM_LINE_SIZE	256		// longer than any formatted line
+
+class DisAsm
+{
+public:
+	DisAsm(uint16 *dna,uint16 *regs)
+	{
+		m_dna = dna;		// points to MAX_DNA sized array
+		m_regs = regs;
+	}
+
+	// these write a line into a DISASM_LINE_SIZE buffer and return its
+	// length; nothing is allocated, so tracing and -z can call them freely
+	int formatCurrentLine(char *line, uint16 start);
+	int formatListingLine(char *line, uint16 location);
+	int formatInstruction(char *line, uint16 location);
+
+	void getDisassembly(std::vector<std::string> &disasm, uint16 start, uint16 end);
+	std::string getCurrentLine(uint16 start)
+	{
+		char line[DISASM_LINE_SIZE];
+		formatCurrentLine(line,start);
+		return(line);
+	}
+
+private:
+	char *putOperand(char *p, char *&value, int instrLocation, int opNum, bool relative);
+	char *putInstruction(char *p, int location, bool appendValues);
+	char *putCell(char *p, uint16 addr);
+
+private:
+	uint16 *m_dna;
+	uint16 *m_regs;
+};
+
+#endif //  #ifndef _DISASM_H_
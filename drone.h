@@ -1,405 +1,405 @@
-//----------------------------------------------------------------------------
-//
-// drone.h
-//
-//----------------------------------------------------------------------------
-//
-// Copyright (c) 2006, Symantec Corporation All rights reserved.
-//
-// Redistribution and use in source and binary forms, with or without
-// modification, are permitted provided that the following conditions are
-// met:
-//
-// -  Redistributions of source code must retain the above copyright notice,
-// this list of conditions and the following disclaimer. 
-//
-// -  Redistributions in binary form must reproduce the above copyright
-// notice, this list of conditions and the following disclaimer in the
-// documentation and/or other materials provided with the distribution. 
-//
-// - Neither the name of Symantec Corp. nor the names of its contributors
-// may be used to endorse or promote products derived from this software
-// without specific prior written permission. 
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
-// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
-// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
-// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-//
-
-#ifndef _DRONE_H_
-
-#define _DRONE_H_
-
-static unsigned short droneArray[3600] = 
-{
-	0x3ABA, 0xBAB1, 0xBABE, 0x3ABA, 0xBAA6, 0xBABE, 0x3ABA, 0xBA94, 0xBABE, 0x3ABA, 
-	0xBAFB, 0xBABE, 0x3AB8, 0x4549, 0xBABE, 0x9A9E, 0xB745, 0xBABA, 0x9A9E, 0xB742, 
-	0xBAB4, 0x9AB1, 0xB742, 0xBABF, 0xBABB, 0xBABE, 0xBABE, 0xFAA0, 0xBABC, 0xBABE, 
-	0x3AB0, 0xBAB1, 0xBABE, 0xFAA4, 0xBABC, 0xBABE, 0xDAA9, 0xBABC, 0x9DAE, 0x3AB7, 
-	0xBAB8, 0xBABE, 0xBAA1, 0xBABE, 0xBABE, 0xBABB, 0xBABE, 0xBABE, 0xFABF, 0xBABE, 
-	0xB745, 0xDA9E, 0xBABF, 0xB746, 0xEA9A, 0xBABE, 0xBABF, 0x3AB0, 0xBAAC, 0xBABE, 
-	0xCAA9, 0xBABE, 0xAABE, 0x3AB5, 0xBAB2, 0xBABE, 0xDA9E, 0xBABF, 0xB4AE, 0xCABF, 
-	0xBABE, 0xAABE, 0xAA9D, 0xB745, 0xBABF, 0xBABB, 0xBABE, 0xBABE, 0x9AA9, 0xB742, 
-	0xBABE, 0x3AB5, 0xBAB1, 0xBABE, 0xBAA5, 0xB745, 0xBABE, 0x3AB0, 0xBAB7, 0xBABE, 
-	0x9AAE, 0xB742, 0xBABF, 0xBABB, 0xBABE, 0xBABE, 0x3ABA, 0x4511, 0xBABE, 0x3AB8, 
-	0x4555, 0xBABE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
-	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
-	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
-	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
-	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
-	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
-	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
-	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
-	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 
-	0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 
-	0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 
-};
-
-#endif // #ifndef _DRONE_H_
+//----------------------------------------------------------------------------
+//
+// drone.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer. 
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution. 
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission. 
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef _DRONE_H_
+
+#define _DRONE_H_
+
+static unsigned short droneArray[3600] = 
+{
+	0x3ABA, 0xBAB1, 0xBABE, 0x3ABA, 0xBAA6, 0xBABE, 0x3ABA, 0xBA94, 0xBABE, 0x3ABA, 
+	0xBAFB, 0xBABE, 0x3AB8, 0x4549, 0xBABE, 0x9A9E, 0xB745, 0xBABA, 0x9A9E, 0xB742, 
+	0xBAB4, 0x9AB1, 0xB742, 0xBABF, 0xBABB, 0xBABE, 0xBABE, 0xFAA0, 0xBABC, 0xBABE, 
+	0x3AB0, 0xBAB1, 0xBABE, 0xFAA4, 0xBABC, 0xBABE, 0xDAA9, 0xBABC, 0x9DAE, 0x3AB7, 
+	0xBAB8, 0xBABE, 0xBAA1, 0xBABE, 0xBABE, 0xBABB, 0xBABE, 0xBABE, 0xFABF, 0xBABE, 
+	0xB745, 0xDA9E, 0xBABF, 0xB746, 0xEA9A, 0xBABE, 0xBABF, 0x3AB0, 0xBAAC, 0xBABE, 
+	0xCAA9, 0xBABE, 0xAABE, 0x3AB5, 0xBAB2, 0xBABE, 0xDA9E, 0xBABF, 0xB4AE, 0xCABF, 
+	0xBABE, 0xAABE, 0xAA9D, 0xB745, 0xBABF, 0xBABB, 0xBABE, 0xBABE, 0x9AA9, 0xB742, 
+	0xBABE, 0x3AB5, 0xBAB1, 0xBABE, 0xBAA5, 0xB745, 0xBABE, 0x3AB0, 0xBAB7, 0xBABE, 
+	0x9AAE, 0xB742, 0xBABF, 0xBABB, 0xBABE, 0xBABE, 0x3ABA, 0x4511, 0xBABE, 0x3AB8, 
+	0x4555, 0xBABE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 
+	0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 
+	0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 
+	0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 
+	0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 
+	0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 
+	0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABF, 0xBABC, 
+	0xBABD, 0xBABA, 0xBABB, 0xBAB8, 0xBAB9, 0xBAB6, 0xBAB7, 0xBAB4, 0xBAB5, 0xBAB2, 
+	0xBAB3, 0xBAB0, 0xBAB1, 0xBAAE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 
+	0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 
+	0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 0xBABE, 
+};
+
+#endif // #ifndef _DRONE_H_
@@ -1,1253 +1,1253 @@
-//----------------------------------------------------------------------------
-//
-// encode.cpp
-//
-//----------------------------------------------------------------------------
-//
-// Copyright (c) 2006, Symantec Corporation All rights reserved.
-//
-// Redistribution and use in source and binary forms, with or without
-// modification, are permitted provided that the following conditions are
-// met:
-//
-// -  Redistributions of source code must retain the above copyright notice,
-// this list of conditions and the following disclaimer. 
-//
-// -  Redistributions in binary form must reproduce the above copyright
-// notice, this list of conditions and the following disclaimer in the
-// documentation and/or other materials provided with the distribution. 
-//
-// - Neither the name of Symantec Corp. nor the names of its contributors
-// may be used to endorse or promote products derived from this software
-// without specific prior written permission. 
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
-// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
-// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
-// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-//
-
-#include <stdio.h>
-
-unsigned short arr[3600] = {
-0x8004, 0x000F, 0x0000,
-0x8004, 0x0018, 0x0000,
-0x8004, 0x002A, 0x0000,
-0x8004, 0x0045, 0x0000,
-0x8006, 0xFFF7, 0x0000,
-0x2020, 0x0DFB, 0x0004,
-0x2020, 0x0DFC, 0x000A,
-0x200F, 0x0DFC, 0x0001,
-0x0005, 0x0000, 0x0000,
-0x401E, 0x0002, 0x0000,
-0x800E, 0x000F, 0x0000,
-0x401A, 0x0002, 0x0000,
-0x6017, 0x0002, 0x2710,
-0x8009, 0x0006, 0x0000,
-0x001F, 0x0000, 0x0000,
-0x0005, 0x0000, 0x0000,
-0x4001, 0x0000, 0x0DFB,
-0x6020, 0x0001, 0x0DF8,
-0x5024, 0x0000, 0x0001,
-0x800E, 0x0012, 0x0000,
-0x7017, 0x0000, 0x1000,
-0x800B, 0x000C, 0x0000,
-0x6020, 0x0001, 0x0E10,
-0x7001, 0x0000, 0x1000,
-0x1023, 0x0DFB, 0x0001,
-0x0005, 0x0000, 0x0000,
-0x2017, 0x0DFC, 0x0000,
-0x800B, 0x000F, 0x0000,
-0x001B, 0x0DFB, 0x0000,
-0x800E, 0x0009, 0x0000,
-0x2010, 0x0DFC, 0x0001,
-0x0005, 0x0000, 0x0000,
-0x8004, 0xFFAF, 0x0000,
-0x8006, 0xFFEB, 0x0000,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0001, 0x0002,
-0x0003, 0x0004, 0x0005,
-0x0006, 0x0007, 0x0008,
-0x0009, 0x000A, 0x000B,
-0x000C, 0x000D, 0x000E,
-0x000F, 0x0010, 0x0001,
-0x0002, 0x0003, 0x0004,
-0x0005, 0x0006, 0x0007,
-0x0008, 0x0009, 0x000A,
-0x000B, 0x000C, 0x000D,
-0x000E, 0x000F, 0x0010,
-0x0001, 0x0002, 0x0003,
-0x0004, 0x0005, 0x0006,
-0x0007, 0x0008, 0x0009,
-0x000A, 0x000B, 0x000C,
-0x000D, 0x000E, 0x000F,
-0x0010, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000
-
-};
-
-
-void main(void)
-{
-	for (int i=0;i<3600;i++)
-	{
-		if (i % 10 == 0)
-			printf("\n\t");
-		arr[i] ^= 0xBABE;
-		printf("0x%04X, ",arr[i]);
-	}
+//----------------------------------------------------------------------------
+//
+// encode.cpp
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer. 
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution. 
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission. 
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <stdio.h>
+
+unsigned short arr[3600] = {
+0x8004, 0x000F, 0x0000,
+0x8004, 0x0018, 0x0000,
+0x8004, 0x002A, 0x0000,
+0x8004, 0x0045, 0x0000,
+0x8006, 0xFFF7, 0x0000,
+0x2020, 0x0DFB, 0x0004,
+0x2020, 0x0DFC, 0x000A,
+0x200F, 0x0DFC, 0x0001,
+0x0005, 0x0000, 0x0000,
+0x401E, 0x0002, 0x0000,
+0x800E, 0x000F, 0x0000,
+0x401A, 0x0002, 0x0000,
+0x6017, 0x0002, 0x2710,
+0x8009, 0x0006, 0x0000,
+0x001F, 0x0000, 0x0000,
+0x0005, 0x0000, 0x0000,
+0x4001, 0x0000, 0x0DFB,
+0x6020, 0x0001, 0x0DF8,
+0x5024, 0x0000, 0x0001,
+0x800E, 0x0012, 0x0000,
+0x7017, 0x0000, 0x1000,
+0x800B, 0x000C, 0x0000,
+0x6020, 0x0001, 0x0E10,
+0x7001, 0x0000, 0x1000,
+0x1023, 0x0DFB, 0x0001,
+0x0005, 0x0000, 0x0000,
+0x2017, 0x0DFC, 0x0000,
+0x800B, 0x000F, 0x0000,
+0x001B, 0x0DFB, 0x0000,
+0x800E, 0x0009, 0x0000,
+0x2010, 0x0DFC, 0x0001,
+0x0005, 0x0000, 0x0000,
+0x8004, 0xFFAF, 0x0000,
+0x8006, 0xFFEB, 0x0000,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0001, 0x0002,
+0x0003, 0x0004, 0x0005,
+0x0006, 0x0007, 0x0008,
+0x0009, 0x000A, 0x000B,
+0x000C, 0x000D, 0x000E,
+0x000F, 0x0010, 0x0001,
+0x0002, 0x0003, 0x0004,
+0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000A,
+0x000B, 0x000C, 0x000D,
+0x000E, 0x000F, 0x0010,
+0x0001, 0x0002, 0x0003,
+0x0004, 0x0005, 0x0006,
+0x0007, 0x0008, 0x0009,
+0x000A, 0x000B, 0x000C,
+0x000D, 0x000E, 0x000F,
+0x0010, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000
+
+};
+
+
+void main(void)
+{
+	for (int i=0;i<3600;i++)
+	{
+		if (i % 10 == 0)
+			printf("\n\t");
+		arr[i] ^= 0xBABE;
+		printf("0x%04X, ",arr[i]);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,685 @@
+//----------------------------------------------------------------------------
+//
+// fuzz.cpp
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#endif // #ifdef WIN32
+
+#include "fuzz.h"
+#include "verify.h"
+#include "compiler.h"
+#include "disasm.h"
+#include "statehash.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#ifdef WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif // #ifdef WIN32
+
+using namespace std;
+
+#define FUZZ_MAX_INSTRS			64		// length of a random program
+#define FUZZ_MAX_MUTATIONS		8		// per case
+#define FUZZ_MAX_SHRINK_RUNS	200		// runs spent minimising one failure
+#define FUZZ_TIMEOUT			60		// seconds before a run counts as hung
+#define FUZZ_MAX_REJECTS_SHOWN	5		// listing lines the assembler refused
+#define FUZZ_LISTING_FILE		"listing.tmp.asm"
+
+enum
+{
+	FUZZ_SAME = 0,
+	FUZZ_DIVERGED,
+	FUZZ_CRASHED
+};
+
+struct FuzzResult
+{
+	int		outcome;		// FUZZ_xxx
+	uint32	tick;			// of the divergence
+	int		signal;			// that ended a crashed run
+};
+
+// a generator of its own, so the worlds draw exactly what they would in a
+// normal run from myrand
+
+class FuzzRandom
+{
+public:
+	FuzzRandom(uint32 seed)
+	{
+		m_state = seed;
+	}
+
+	uint32 next(void)
+	{
+		m_state += 0x9E3779B97F4A7C15ULL;
+		return((uint32)hashMix(0,m_state));
+	}
+
+	uint32 below(uint32 n)
+	{
+		return(next() % n);
+	}
+
+	bool oneIn(uint32 n)
+	{
+		return(below(n) == 0);
+	}
+
+	uint16 pick(const uint16 *values, uint32 n)
+	{
+		return(values[below(n)]);
+	}
+
+private:
+	uint64	m_state;
+};
+
+#define PICK(r,values)	(r).pick(values,sizeof(values)/sizeof(values[0]))
+
+// the edges where decoding and bounds checks go wrong
+
+static const uint16 g_values[] =
+{
+	0, 1, 2, 3, 15, 16, 17, 255, 0x7FFF, 0x8000, 0xFFFF,
+	MAX_DNA-INSTR_SLOTS, MAX_DNA-1, MAX_DNA
+};
+
+static const uint16 g_addresses[] =
+{
+	0, 1, INSTR_SLOTS, MAX_DNA-INSTR_SLOTS, MAX_DNA-1, MAX_DNA, 0x7FFF, 0xFFFF
+};
+
+// 13 bit indexed offsets: -4096, -4095, -1, 0, 1, 4095
+static const uint16 g_offsets[] =
+{
+	0x1000, 0x1001, 0x1FFF, 0, 1, 0x0FFF
+};
+
+static uint16 randomOperand(FuzzRandom &r, uint16 &word0, int opNum, bool relative, uint16 location)
+{
+	uint16 mode = (uint16)r.below(4);
+	word0 |= mode << (14-opNum*2);
+
+	switch (mode)
+	{
+		case ADDR_MODE_REG:
+			// now and then a register past the end of the file
+			return(r.oneIn(16) ? PICK(r,g_values) : (uint16)r.below(MAX_REGS));
+
+		case ADDR_MODE_DNA_DIRECT:
+			return(r.oneIn(2) ? PICK(r,g_addresses) : (uint16)r.below(MAX_DNA));
+
+		case ADDR_MODE_IMMED:
+			if (relative == false)
+				return(r.oneIn(2) ? PICK(r,g_values) : (uint16)r.next());
+
+			// mostly short aligned branches; some misaligned or off the end
+			switch (r.below(4))
+			{
+				case 0:
+					return((uint16)(r.below(MAX_DNA) - location));
+				case 1:
+					return((uint16)(INSTR_SLOTS*r.below(8) + 1 + r.below(INSTR_SLOTS-1)));
+				case 2:
+					return(PICK(r,g_values));
+				default:
+					return((uint16)(INSTR_SLOTS*((sint32)r.below(17) - 8)));
+			}
+
+		default:	// ADDR_MODE_DNA_INDEXED_DIRECT
+			{
+				uint16 off = r.oneIn(2) ? PICK(r,g_offsets) : (uint16)r.below(OFFSET_TOP_BIT_MASK*2);
+				if (off & OFFSET_TOP_BIT_MASK)
+					word0 |= 1 << (11-opNum);
+				return((uint16)((r.below(MAX_REGS) << 12) | (off & OFFSET_MASK)));
+			}
+	}
+}
+
+static void randomInstruction(FuzzRandom &r, uint16 *image, uint16 location)
+{
+	// the odd undefined opcode, executed as data
+	uint16 oc = (uint16)(r.oneIn(32) ? r.below(OPCODE_MASK+1) : r.below(OPCODE_CKSUM+1));
+	uint16 word0 = oc;
+	Instr info;
+
+	info.setOpcode(oc,"");
+	image[location+1] = 0;
+	image[location+2] = 0;
+	for (uint32 i=0;i<info.getNumOperands() && oc <= OPCODE_CKSUM;i++)
+		image[location+1+i] = randomOperand(r,word0,i,info.isRelative(),location);
+
+	// and the odd stray bit no assembler would set
+	if (r.oneIn(32))
+		word0 |= (uint16)(r.next() & ~OPCODE_MASK);
+
+	image[location] = word0;
+}
+
+static void mutate(FuzzRandom &r, uint16 *image, uint32 numInstrs)
+{
+	uint32 count = 1 + r.below(FUZZ_MAX_MUTATIONS);
+
+	for (uint32 i=0;i<count;i++)
+	{
+		uint16 location = (uint16)(r.below(numInstrs) * INSTR_SLOTS);
+		uint16 slot = (uint16)(location + r.below(INSTR_SLOTS));
+
+		switch (r.below(4))
+		{
+			case 0:
+				randomInstruction(r,image,location);
+				break;
+			case 1:
+				image[slot] ^= (uint16)(1 << r.below(16));
+				break;
+			case 2:
+				image[slot] = PICK(r,g_values);
+				break;
+			default:	// copy another instruction over this one
+				memmove(image+location,image+r.below(numInstrs)*INSTR_SLOTS,INSTR_SLOTS*sizeof(uint16));
+				break;
+		}
+	}
+}
+
+// instructions up to the last non-nop one
+static uint32 getNumInstrs(const uint16 *image)
+{
+	uint32 n = MAX_DNA;
+	while (n > 0 && image[n-1] == 0)
+		n--;
+	return((n + INSTR_SLOTS-1) / INSTR_SLOTS);
+}
+
+//----------------------------------------------------------------------------
+// engines
+
+// one engine against the reference.  Where there is fork(), in a child
+// process, so a crash or a hang is caught and reported instead of taking
+// the fuzzer with it
+
+static void runImage(Settings &s, const uint16 *image, OrganismBinary *drone, int engine, FuzzResult &result)
+{
+	uint16 arr[MAX_DNA];
+	memcpy(arr,image,sizeof(arr));
+	OrganismBinary *player = new OrganismBinary(arr,MAX_DNA,"fuzz");
+
+	result.outcome = FUZZ_SAME;
+	result.tick = 0;
+	result.signal = 0;
+
+#ifndef WIN32
+	int fds[2];
+	pid_t pid = -1;
+
+	fflush(stdout);
+	if (pipe(fds) == 0)
+	{
+		pid = fork();
+		if (pid < 0)
+		{
+			close(fds[0]);
+			close(fds[1]);
+		}
+	}
+
+	if (pid == 0)
+	{
+		close(fds[0]);
+		alarm(FUZZ_TIMEOUT);
+		bool same = verifyEngine(s,player,drone,engine,NULL,&result.tick);
+		if (write(fds[1],&result.tick,sizeof(result.tick)) != sizeof(result.tick))
+			_exit(2);
+		_exit(same ? 0 : 1);
+	}
+
+	if (pid > 0)
+	{
+		int status = 0;
+
+		close(fds[1]);
+		if (read(fds[0],&result.tick,sizeof(result.tick)) != sizeof(result.tick))
+			result.tick = 0;
+		close(fds[0]);
+		waitpid(pid,&status,0);
+
+		if (WIFSIGNALED(status))
+		{
+			result.outcome = FUZZ_CRASHED;
+			result.signal = WTERMSIG(status);
+		}
+		else if (WIFEXITED(status) == false || WEXITSTATUS(status) != 0)
+			result.outcome = FUZZ_DIVERGED;
+
+		delete player;
+		return;
+	}
+#endif // #ifndef WIN32
+
+	if (verifyEngine(s,player,drone,engine,NULL,&result.tick) == false)
+		result.outcome = FUZZ_DIVERGED;
+	delete player;
+}
+
+// delta debugging: clear ever smaller runs of instructions, keeping each
+// change that leaves the same kind of failure, and stop a diverging run at
+// the tick it goes wrong
+
+static void shrink(Settings &s, uint16 *image, OrganismBinary *drone, int engine, FuzzResult &result)
+{
+	uint32 numInstrs = getNumInstrs(image), runs = 0;
+	uint16 trial[MAX_DNA];
+
+	if (result.outcome == FUZZ_DIVERGED)
+		s.setMaxIterations(result.tick+1);
+
+	for (uint32 chunk=(numInstrs+1)/2;chunk > 0 && runs < FUZZ_MAX_SHRINK_RUNS;chunk/=2)
+	{
+		for (uint32 first=0;first < numInstrs && runs < FUZZ_MAX_SHRINK_RUNS;first+=chunk)
+		{
+			uint32 last = min(first+chunk,numInstrs);
+			bool changed = false;
+
+			memcpy(trial,image,sizeof(trial));
+			for (uint32 i=first*INSTR_SLOTS;i<last*INSTR_SLOTS;i++)
+			{
+				changed = changed || trial[i] != 0;
+				trial[i] = 0;
+			}
+			if (changed == false)
+				continue;
+
+			FuzzResult got;
+			runImage(s,trial,drone,engine,got);
+			runs++;
+			if (got.outcome != result.outcome)
+				continue;
+
+			memcpy(image,trial,sizeof(trial));
+			result = got;
+			if (result.outcome == FUZZ_DIVERGED)
+				s.setMaxIterations(result.tick+1);
+		}
+	}
+}
+
+static string getFixtureName(const string &dir, uint32 fuzzSeed, uint32 caseNum, const char *suffix)
+{
+	char name[64];
+	sprintf(name,"/fuzz-%u-%u%s.asm",fuzzSeed,caseNum,suffix);
+	return(dir + name);
+}
+
+// the image as data, one instruction per line, with a command that replays
+// the failure
+
+static bool writeEngineFixture(const string &fileName, Settings &s, int engine, const FuzzResult &result, uint16 *image)
+{
+	FILE *f = fopen(fileName.c_str(),"wt");
+	if (f == NULL)
+		return(false);
+
+	fprintf(f,"info: fuzz, contest06 --fuzz\n");
+	if (result.outcome == FUZZ_DIVERGED)
+		fprintf(f,"// the %s engine diverges from %s at tick %u on seed %u\n",
+			getEngineName(engine),getEngineName(ENGINE_SWITCH),result.tick,s.getSeed());
+	else
+		fprintf(f,"// the %s engine dies with signal %d on seed %u\n",
+			getEngineName(engine),result.signal,s.getSeed());
+	fprintf(f,"// replay: contest06 -p:%s -s:%u -i:%u --verify:1,%s\n",
+		fileName.c_str(),s.getSeed(),s.getMaxIterations(),getEngineName(engine));
+
+	DisAsm d(image,NULL);
+	uint32 numInstrs = getNumInstrs(image);
+	for (uint32 i=0;i<numInstrs;i++)
+	{
+		uint16 *instr = image + i*INSTR_SLOTS;
+		char line[DISASM_LINE_SIZE];
+
+		d.formatInstruction(line,(uint16)(i*INSTR_SLOTS));
+		fprintf(f,"data { %u %u %u }\t// %04u  %s\n",instr[0],instr[1],instr[2],i*INSTR_SLOTS,line);
+	}
+
+	fclose(f);
+	return(true);
+}
+
+//----------------------------------------------------------------------------
+// assembler
+
+// whether the disassembler's text for an instruction should assemble back
+// to the same words: a defined opcode, no stray mode or offset bits, no
+// unused operand words and no immediate where the compiler wants an l-value
+
+static bool isAssemblable(const uint16 *instr)
+{
+	uint16 oc = instr[0] & OPCODE_MASK;
+	if (oc > OPCODE_CKSUM)
+		return(false);
+
+	Instr info;
+	uint16 used = OPCODE_MASK;
+
+	info.setOpcode(oc,"");
+	for (uint32 i=0;i<INSTR_SLOTS-1;i++)
+	{
+		if (i >= info.getNumOperands())
+		{
+			if (instr[i+1] != 0)
+				return(false);
+			continue;
+		}
+
+		uint16 mode = (instr[0] >> (14-i*2)) & 0x3;
+		used |= 0x3 << (14-i*2);
+
+		if (mode == ADDR_MODE_DNA_INDEXED_DIRECT)
+			used |= 1 << (11-i);
+		else if (mode == ADDR_MODE_IMMED && (info.getLValueMask() & (OP1_LVALUE << i)))
+			return(false);
+		else if (mode == ADDR_MODE_REG && instr[i+1] >= MAX_REGS)
+			return(false);
+	}
+
+	return((instr[0] & ~used) == 0);
+}
+
+// the info line is line 1 and instruction i is on line i+2
+static void writeListing(FILE *f, uint16 *image, uint32 numInstrs, const vector<bool> &asData, bool crlf = false)
+{
+	DisAsm d(image,NULL);
+	const char *eol = crlf ? "\r\n" : "\n";
+
+	fprintf(f,"info: fuzz, contest06 --fuzz%s",eol);
+	for (uint32 i=0;i<numInstrs;i++)
+	{
+		uint16 *instr = image + i*INSTR_SLOTS;
+		char line[DISASM_LINE_SIZE];
+
+		if (asData[i])
+			fprintf(f,"data { %u %u %u }%s",instr[0],instr[1],instr[2],eol);
+		else
+		{
+			d.formatInstruction(line,(uint16)(i*INSTR_SLOTS));
+			fprintf(f,"%s%s",line,eol);
+		}
+	}
+}
+
+// assemble a listing; false with the error if the compiler refuses it.
+// lines, if given, gets the source line the compiler recorded for each slot
+static bool assemble(const string &fileName, uint16 *image, uint32 numInstrs, const vector<bool> &asData, uint16 *out, string &error,
+	bool crlf = false, uint32 *lines = NULL)
+{
+	FILE *f = fopen(fileName.c_str(),crlf ? "wb" : "wt");
+	if (f == NULL)
+	{
+		error = "unable to write " + fileName;
+		return(false);
+	}
+	writeListing(f,image,numInstrs,asData,crlf);
+	fclose(f);
+
+	Compiler c;
+	if (c.compile(fileName,error) == false)
+		return(false);
+
+	OrganismBinary *ob = c.getProgram();
+	if (ob == NULL)
+	{
+		error = "program size exceeds NANORG memory size";
+		return(false);
+	}
+
+	memset(out,0,MAX_DNA*sizeof(uint16));
+	ob->getProgram(out);
+	if (lines != NULL)
+		for (uint16 slot=0;slot<MAX_DNA;slot++)
+			lines[slot] = ob->getSourceLine(slot);
+	delete ob;
+	return(true);
+}
+
+struct RoundTrip
+{
+	RoundTrip()
+	{
+		instrs = 0;
+		rejected = 0;
+		failed = 0;
+	}
+
+	uint32	instrs;				// listed as text
+	uint32	rejected;			// of those, refused by the compiler
+	uint32	failed;				// listings that assembled to other words, or
+								// that --profile would annotate on the wrong lines
+};
+
+static void appendReplay(const string &fileName, const char *what)
+{
+	FILE *f = fopen(fileName.c_str(),"at");
+	if (f == NULL)
+		return;
+	fprintf(f,"// %s\n",what);
+	fprintf(f,"// replay: contest06 -z:%s\n",fileName.c_str());
+	fclose(f);
+}
+
+// disassemble, reassemble and compare.  Each instruction is tried alone
+// first (at 0: branch operands are relative, so it encodes the same there),
+// which is where most faults show and where they are easiest to read.
+// Instructions the compiler refuses are reported and listed as data from
+// then on; the whole listing is then assembled for faults that need
+// context, with CRLF line endings every other case, and the source map
+// --profile annotates from is checked against the listing's lines.  A
+// failure is written to the fuzz directory as a fixture
+
+static void roundTrip(FILE *stream, const string &dir, uint32 fuzzSeed, uint32 caseNum, uint16 *image, RoundTrip &totals)
+{
+	uint32 numInstrs = max(getNumInstrs(image),(uint32)1);
+	vector<bool> asData(numInstrs), text(1,false);
+	uint16 out[MAX_DNA], single[MAX_DNA];
+	string listing = dir + "/" + FUZZ_LISTING_FILE, error;
+	string fileName = getFixtureName(dir,fuzzSeed,caseNum,"-asm");
+	char line[DISASM_LINE_SIZE], what[DISASM_LINE_SIZE];
+
+	memset(single,0,sizeof(single));
+	for (uint32 i=0;i<numInstrs;i++)
+	{
+		uint16 *instr = image + i*INSTR_SLOTS;
+
+		asData[i] = !isAssemblable(instr);
+		if (asData[i])
+			continue;
+
+		totals.instrs++;
+		memcpy(single,instr,INSTR_SLOTS*sizeof(uint16));
+		DisAsm d(single,NULL);
+		d.formatInstruction(line,0);
+
+		if (assemble(listing,single,1,text,out,error) == false)
+		{
+			if (totals.rejected++ < FUZZ_MAX_REJECTS_SHOWN)
+				fprintf(stream,"Case %u: the assembler rejects \"%s\": %s\n",caseNum,line,error.c_str());
+			asData[i] = true;
+		}
+		else if (memcmp(single,out,INSTR_SLOTS*sizeof(uint16)) != 0)
+		{
+			sprintf(what,"disassembled from %04X %04X %04X; assembles to %04X %04X %04X",
+				single[0],single[1],single[2],out[0],out[1],out[2]);
+			if (assemble(fileName,single,1,text,out,error) == true)
+				appendReplay(fileName,what);
+			fprintf(stream,"Case %u: \"%s\" %s -> %s\n",caseNum,line,what,fileName.c_str());
+			remove(listing.c_str());
+			totals.failed++;
+			return;
+		}
+	}
+
+	bool crlf = (caseNum & 1) != 0;
+	uint32 lines[MAX_DNA];
+	bool assembled = assemble(listing,image,numInstrs,asData,out,error,crlf,lines);
+	remove(listing.c_str());
+
+	uint32 bad = 0, misplaced = 0;
+	while (assembled && bad < numInstrs && memcmp(image+bad*INSTR_SLOTS,out+bad*INSTR_SLOTS,INSTR_SLOTS*sizeof(uint16)) == 0)
+		bad++;
+	while (assembled && misplaced < numInstrs && lines[misplaced*INSTR_SLOTS] == misplaced+2)
+		misplaced++;
+	if (assembled && bad == numInstrs && misplaced == numInstrs)
+		return;
+
+	// only wrong in context: keep the whole listing
+	FILE *f = fopen(fileName.c_str(),crlf ? "wb" : "wt");
+	if (f != NULL)
+	{
+		writeListing(f,image,numInstrs,asData,crlf);
+		fclose(f);
+	}
+
+	if (assembled == false)
+		sprintf(what,"the listing does not assemble");
+	else if (bad < numInstrs)
+		sprintf(what,"slot %u: %04X %04X %04X assembles to %04X %04X %04X",bad*INSTR_SLOTS,
+			image[bad*INSTR_SLOTS],image[bad*INSTR_SLOTS+1],image[bad*INSTR_SLOTS+2],
+			out[bad*INSTR_SLOTS],out[bad*INSTR_SLOTS+1],out[bad*INSTR_SLOTS+2]);
+	else
+		sprintf(what,"slot %u: from line %u of the %s listing, recorded as line %u",misplaced*INSTR_SLOTS,
+			misplaced+2,crlf ? "CRLF" : "LF",lines[misplaced*INSTR_SLOTS]);
+	appendReplay(fileName,what);
+	fprintf(stream,"Case %u: %s%s%s -> %s\n",caseNum,what,
+		assembled ? "" : ": ",assembled ? "" : error.c_str(),fileName.c_str());
+	totals.failed++;
+}
+
+static void makeDirectory(const string &dir)
+{
+#ifdef WIN32
+	_mkdir(dir.c_str());
+#else
+	mkdir(dir.c_str(),0777);
+#endif // #ifdef WIN32
+}
+
+//----------------------------------------------------------------------------
+
+bool fuzzEngines(Settings &s, OrganismBinary *player, OrganismBinary *drone, FILE *stream)
+{
+	uint32 fuzzSeed = s.getSeed(), ticks = min(s.getMaxIterations(),(uint32)DEFAULT_FUZZ_TICKS);
+	uint32 diverged = 0, crashed = 0, baseInstrs = FUZZ_MAX_INSTRS;
+	uint16 base[MAX_DNA];
+	string dir = s.getFuzzDir();
+	FuzzRandom r(fuzzSeed);
+	RoundTrip totals;
+
+	makeDirectory(dir);
+	memset(base,0,sizeof(base));
+	if (player != NULL)
+	{
+		player->getProgram(base);
+		baseInstrs = max(getNumInstrs(base),(uint32)1);
+	}
+
+	s.setQuiet(true);
+	for (uint32 caseNum=0;caseNum<s.getFuzzCases();caseNum++)
+	{
+		uint16 image[MAX_DNA];
+		uint32 numInstrs = baseInstrs;
+
+		memcpy(image,base,sizeof(image));
+		if (player == NULL)
+		{
+			numInstrs = 1 + r.below(FUZZ_MAX_INSTRS);
+			for (uint32 i=0;i<numInstrs;i++)
+				randomInstruction(r,image,(uint16)(i*INSTR_SLOTS));
+		}
+		mutate(r,image,numInstrs);
+
+		uint32 seed = r.next();
+		for (int engine=ENGINE_SWITCH+1;engine<NUM_ENGINES;engine++)
+		{
+			FuzzResult result;
+
+			s.setSeed(seed);
+			s.setMaxIterations(ticks);
+			runImage(s,image,drone,engine,result);
+			if (result.outcome == FUZZ_SAME)
+				continue;
+
+			uint16 small[MAX_DNA];
+			memcpy(small,image,sizeof(small));
+			shrink(s,small,drone,engine,result);
+
+			string fileName = getFixtureName(dir,fuzzSeed,caseNum,"");
+			if (writeEngineFixture(fileName,s,engine,result,small) == false)
+				fileName = "(unable to write " + fileName + ")";
+
+			if (result.outcome == FUZZ_DIVERGED)
+			{
+				fprintf(stream,"Case %u: %s diverges at tick %u on seed %u -> %s\n",
+					caseNum,getEngineName(engine),result.tick,seed,fileName.c_str());
+				diverged++;
+			}
+			else
+			{
+				fprintf(stream,"Case %u: %s dies with signal %d on seed %u -> %s\n",
+					caseNum,getEngineName(engine),result.signal,seed,fileName.c_str());
+				crashed++;
+			}
+		}
+
+		roundTrip(stream,dir,fuzzSeed,caseNum,image,totals);
+	}
+
+	fprintf(stream,"%u cases from seed %u, %u ticks each: %u diverged, %u crashed\n",
+		s.getFuzzCases(),fuzzSeed,ticks,diverged,crashed);
+	fprintf(stream,"assembler: %u instructions listed, %u rejected, %u listings reassembled or mapped wrong\n",
+		totals.instrs,totals.rejected,totals.failed);
+
+	s.setSeed(fuzzSeed);
+	return(diverged == 0 && crashed == 0 && totals.failed == 0);
+}
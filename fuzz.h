@@ -0,0 +1,60 @@
+//----------------------------------------------------------------------------
+//
+// fuzz.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef _FUZZ_H_
+
+#define _FUZZ_H_
+
+#include <stdio.h>
+
+#include "types.h"
+#include "settings.h"
+
+class OrganismBinary;
+
+// --fuzz: differential testing of the engines and the assembler.  Each case
+// mutates a DNA image (the player's, or a random program) and picks a world
+// seed, then runs it under every engine against ENGINE_SWITCH (--verify's
+// lockstep comparison) and round trips it through the disassembler and the
+// compiler.  Divergences, crashes and mismatches are minimised and written
+// to the fuzz directory as .asm fixtures that replay the failure.
+
+// s.getFuzzCases() cases from s.getSeed(); player may be NULL.  false if
+// anything failed
+bool fuzzEngines(Settings &s, OrganismBinary *player, OrganismBinary *drone, FILE *stream);
+
+
+#endif // #ifndef _FUZZ_H_
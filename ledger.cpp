@@ -0,0 +1,127 @@
+//----------------------------------------------------------------------------
+//
+// ledger.cpp
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include "ledger.h"
+
+#include <cstring>
+
+SpeciesLedger::SpeciesLedger()
+{
+	memset(this,0,sizeof(*this));
+}
+
+void SpeciesLedger::add(const EnergyLedger &l, sint32 finalEnergy)
+{
+	// the balance: start + gains - spending = final
+	sint64 spent = (sint64)l.start + l.food + l.chargeReceived -
+		l.travel - l.chargeSent - l.releasedOnPoint - l.releasedOffPoint - finalEnergy;
+
+	organisms++;
+	start += l.start;
+	compute += spent > 0 ? (uint64)spent : 0;
+	travel += l.travel;
+	failedTravels += l.failedTravels;
+	food += l.food;
+	chargeSent += l.chargeSent;
+	chargeReceived += l.chargeReceived;
+	releasedOnPoint += l.releasedOnPoint;
+	releasedOffPoint += l.releasedOffPoint;
+	poisonMutations += l.poisonMutations;
+	final += finalEnergy;
+}
+
+void SpeciesLedger::add(const SpeciesLedger &other)
+{
+	organisms += other.organisms;
+	start += other.start;
+	compute += other.compute;
+	travel += other.travel;
+	failedTravels += other.failedTravels;
+	food += other.food;
+	chargeSent += other.chargeSent;
+	chargeReceived += other.chargeReceived;
+	releasedOnPoint += other.releasedOnPoint;
+	releasedOffPoint += other.releasedOffPoint;
+	poisonMutations += other.poisonMutations;
+	final += other.final;
+}
+
+void repeatLedger(EnergyLedger &l, const EnergyLedger &before, uint32 periods)
+{
+	l.travel += periods * (l.travel - before.travel);
+	l.failedTravels += periods * (l.failedTravels - before.failedTravels);
+	l.food += periods * (l.food - before.food);
+	l.chargeSent += periods * (l.chargeSent - before.chargeSent);
+	l.chargeReceived += periods * (l.chargeReceived - before.chargeReceived);
+	l.releasedOnPoint += periods * (l.releasedOnPoint - before.releasedOnPoint);
+	l.releasedOffPoint += periods * (l.releasedOffPoint - before.releasedOffPoint);
+	l.poisonMutations += periods * (l.poisonMutations - before.poisonMutations);
+}
+
+void printLedgerHeader(FILE *stream, const char *first)
+{
+	fprintf(stream,"%-12s %9s %11s %10s %10s %11s %10s %10s %12s %10s %7s %9s\n",
+		first,"start","compute","travel","failed","food","sent","received",
+		"released","wasted","poison","final");
+}
+
+void printLedgerLine(FILE *stream, const char *first, const EnergyLedger &l, sint32 finalEnergy)
+{
+	SpeciesLedger one;
+
+	one.add(l,finalEnergy);
+	printLedgerLine(stream,first,one);
+}
+
+// failed travel is shown as the compute energy those attempts burned, which
+// the compute column already includes
+
+void printLedgerLine(FILE *stream, const char *first, const SpeciesLedger &l)
+{
+	fprintf(stream,"%-12s %9llu %11llu %10llu %10llu %11llu %10llu %10llu %12llu %10llu %7llu %9lld\n",
+		first,
+		(unsigned long long)l.start,
+		(unsigned long long)l.compute,
+		(unsigned long long)l.travel,
+		(unsigned long long)(l.failedTravels * COMPUTE_ENERGY),
+		(unsigned long long)l.food,
+		(unsigned long long)l.chargeSent,
+		(unsigned long long)l.chargeReceived,
+		(unsigned long long)l.releasedOnPoint,
+		(unsigned long long)l.releasedOffPoint,
+		(unsigned long long)l.poisonMutations,
+		(long long)l.final);
+}
@@ -0,0 +1,93 @@
+//----------------------------------------------------------------------------
+//
+// ledger.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef _LEDGER_H_
+
+#define _LEDGER_H_
+
+#include <stdio.h>
+
+#include "types.h"
+#include "constants.h"
+
+// where an organism's energy went (--ledger).  Only the rare events are
+// counted, so every organism keeps one whether or not it is reported; the
+// energy spent on compute is whatever the other entries leave unexplained.
+
+struct EnergyLedger
+{
+	sint32	start;				// energy at birth (or at --resume)
+	uint32	travel;				// TRAVEL_ENERGY per successful move
+	uint32	failedTravels;		// moves that went nowhere; compute only
+	uint32	food;
+	uint32	chargeSent;
+	uint32	chargeReceived;
+	uint32	releasedOnPoint;	// scored
+	uint32	releasedOffPoint;	// wasted
+	uint32	poisonMutations;
+};
+
+// ledgers summed over a species, and over runs
+
+struct SpeciesLedger
+{
+	SpeciesLedger();
+	void add(const EnergyLedger &l, sint32 finalEnergy);
+	void add(const SpeciesLedger &other);
+
+	uint64	organisms;
+	uint64	start;
+	uint64	compute;
+	uint64	travel;
+	uint64	failedTravels;
+	uint64	food;
+	uint64	chargeSent;
+	uint64	chargeReceived;
+	uint64	releasedOnPoint;
+	uint64	releasedOffPoint;
+	uint64	poisonMutations;
+	sint64	final;
+};
+
+// l after periods more repeats of its change since before (--cycles)
+void repeatLedger(EnergyLedger &l, const EnergyLedger &before, uint32 periods);
+
+void printLedgerHeader(FILE *stream, const char *first);
+void printLedgerLine(FILE *stream, const char *first, const EnergyLedger &l, sint32 finalEnergy);
+void printLedgerLine(FILE *stream, const char *first, const SpeciesLedger &l);
+
+
+#endif // #ifndef _LEDGER_H_
@@ -0,0 +1,140 @@
+//----------------------------------------------------------------------------
+//
+// mappedfile.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+#ifndef _MAPPEDFILE_H_
+
+#define _MAPPEDFILE_H_
+
+#include <stdio.h>
+#include <string>
+
+#include "types.h"
+
+#ifndef WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif // #ifndef WIN32
+
+// read-only view of a whole file.  Pages are mapped on demand so huge files
+// (traces) cost only what is touched; WIN32 reads the file instead.
+
+class MappedFile
+{
+public:
+	MappedFile()
+	{
+		m_data = NULL;
+		m_size = 0;
+	}
+
+	~MappedFile()
+	{
+		close();
+	}
+
+	bool open(const std::string &file)
+	{
+		close();
+
+#ifndef WIN32
+		int fd = ::open(file.c_str(),O_RDONLY);
+		struct stat st;
+
+		if (fd >= 0 && fstat(fd,&st) == 0 && st.st_size > 0)
+		{
+			void *p = mmap(NULL,(size_t)st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+			if (p != MAP_FAILED)
+			{
+				m_data = (const uint8 *)p;
+				m_size = (size_t)st.st_size;
+			}
+		}
+		if (fd >= 0)
+			::close(fd);
+#else
+		FILE *stream = fopen(file.c_str(),"rb");
+		if (stream != NULL)
+		{
+			fseek(stream,0,SEEK_END);
+			size_t size = ftell(stream);
+			fseek(stream,0,SEEK_SET);
+			uint8 *buf = new uint8[size];
+			if (fread(buf,1,size,stream) == size)
+			{
+				m_data = buf;
+				m_size = size;
+			}
+			else
+				delete [] buf;
+			fclose(stream);
+		}
+#endif // #ifndef WIN32
+
+		return(m_data != NULL);
+	}
+
+	void close(void)
+	{
+		if (m_data == NULL)
+			return;
+#ifndef WIN32
+		munmap((void *)m_data,m_size);
+#else
+		delete [] m_data;
+#endif // #ifndef WIN32
+		m_data = NULL;
+		m_size = 0;
+	}
+
+	const uint8 *getData(void) const
+	{
+		return(m_data);
+	}
+
+	size_t getSize(void) const
+	{
+		return(m_size);
+	}
+
+private:
+	const uint8	*m_data;
+	size_t		m_size;
+};
+
+#endif // #ifndef _MAPPEDFILE_H_
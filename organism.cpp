@@ -1,1154 +1,1667 @@
-//----------------------------------------------------------------------------
-//
-// organism.cpp
-//
-//----------------------------------------------------------------------------
-//
-// Copyright (c) 2006, Symantec Corporation All rights reserved.
-//
-// Redistribution and use in source and binary forms, with or without
-// modification, are permitted provided that the following conditions are
-// met:
-//
-// -  Redistributions of source code must retain the above copyright notice,
-// this list of conditions and the following disclaimer. 
-//
-// -  Redistributions in binary form must reproduce the above copyright
-// notice, this list of conditions and the following disclaimer in the
-// documentation and/or other materials provided with the distribution. 
-//
-// - Neither the name of Symantec Corp. nor the names of its contributors
-// may be used to endorse or promote products derived from this software
-// without specific prior written permission. 
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
-// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
-// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
-// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-//
-
-#ifdef WIN32
-#pragma warning(disable:4786)
-#endif // #ifdef WIN32
-
-#include "world.h"
-#include "organism.h"
-#include "disasm.h"
-#include "mycon.h"
-
-#include <string>
-#include <cstring>
-#include <ctime>
-#include <cstdlib>
-#include <cstdio>
-#include <cctype>
-
-using namespace std;
-
-Organism::Organism
-(
-	World *world, 
-	uint16  *myDNA, 
-	uint16 dnaSize,
-	uint32 startEnergy, 
-	uint16 organismID,
-	bool singleStep,
-	const std::string & moduleInfo, 
-	FILE *debugStream, 
-	bool noMutate,
-	CConsole *console
-)
-{
-	m_ip = START_IP;
-	m_world = world;
-	m_energy = startEnergy;
-	m_noMutate = noMutate;
-	m_moduleInfo = moduleInfo;
-	m_organismID = organismID;
-	m_oldX = m_x = INVALID_COORD;
-	m_oldY = m_y = INVALID_COORD;
-	m_singleStep = singleStep;
-	m_goUntilIP = INVALID_IP;
-	m_traceCount = 0;
-
-	m_console = console;
-
-	// bot name
-
-	int spaceOff = m_moduleInfo.find_first_of(" ,\t");
-	if (spaceOff != -1)
-		m_botName = m_moduleInfo.substr(0,spaceOff);
-	else
-		m_botName = m_moduleInfo;
-
-
-	uint32 i;
-	// set DNA
-	for (i=0;i<dnaSize && i < MAX_DNA;i++)
-		m_dna[i] = myDNA[i];
-	// clear out remainder of DNA
-	for (i=dnaSize;i < MAX_DNA;i++)
-		m_dna[i] = 0;
-	for (i=0;i<MAX_REGS;i++)
-		m_regs[i] = 0;
-	m_regs[SP_REG] = MAX_DNA;		// predecrement then internalPush
-
-	m_disasm = new DisAsm(m_dna,m_regs);
-
-	// open debug file
-
-	m_debugStream = debugStream;
-}
-
-Organism::~Organism()
-{
-	if (m_debugStream != NULL)
-		fclose(m_debugStream);
-
-	if (m_disasm != NULL)
-		delete m_disasm;
-}
-
-
-bool Organism::alive(void)
-{
-	return(m_energy > 0);
-}
-
-void Organism::travel(void)
-{
-	// op1 = direction, op2 = result register
-
-	uint16 newX, newY;
-	uint16 dir = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-
-	if (newXY(dir,&newX,&newY) == false)
-		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-	else if (m_world->occupied(newX,newY) != NULL)
-		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-	else
-	{
-		m_oldX = m_x;
-		m_oldY = m_y;
-		m_x = newX;
-		m_y = newY;
-		m_regs[FLAGS_REG] |= FLAG_SUCCESS;
-		m_energy -= TRAVEL_ENERGY;
-	}
-}
-
-
-void Organism::eat(void)
-{
-	if (m_energy + FOOD_ENERGY > MAX_ORGANISM_ENERGY)
-	{
-		// too full!
-		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-		return;
-	}
-
-	if (m_world->eatFood(this,m_x,m_y) == true)
-	{
-		m_regs[FLAGS_REG] |= FLAG_SUCCESS;
-		m_energy += FOOD_ENERGY;
-	}
-	else
-		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-}
-
-void Organism::sense(void)		// sense food on current square; id put in operand1
-{
-	uint16 result = m_world->getFoodID(m_x,m_y);
-
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],result);
-	if (result != 0)
-		m_regs[FLAGS_REG] |= FLAG_SUCCESS;
-	else
-		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-}
-
-uint32 Organism::getEnergy(void)
-{
-	return(m_energy);
-}
-
-bool Organism::getDNAValue(uint16 slot, uint16 & value)
-{
-	if (slot >= MAX_DNA)
-		return(false);
-	value = m_dna[slot];
-	return(true);
-}
-
-bool Organism::setDNAValue(uint16 slot, uint16 value)
-{
-	if (slot >= MAX_DNA)
-		return (false);
-	m_dna[slot] = value;
-	return(true);
-}
-
-
-
-bool Organism::newXY(uint16 dir, uint16 *newX, uint16 *newY)
-{
-	*newX = m_x;
-	*newY = m_y;
-
-	switch (dir % 4)
-	{
-		case DIR_NORTH:
-			(*newY)--;
-			break;
-		case DIR_SOUTH:
-			(*newY)++;
-			break;
-		case DIR_EAST:
-			(*newX)++;
-			break;
-		case DIR_WEST:
-			(*newX)--;
-			break;
-		default:
-			return(false);
-	}
-
-	return(*newX < GRID_WIDTH && *newY < GRID_HEIGHT);
-}
-
-uint32 Organism::oppositeDir(uint32 dir)
-{
-	return(3-(dir%4));
-}
-
-// operand #0: bit 14-15: 00=register, 01=memory, 10=constant
-// operand #1: bit 12-13: 00=register, 01=memory, 10=constant
-// operand #2: bit 10-11: 00=register, 01=memory, 10=constant
-
-uint16 Organism::getValue(uint16 opcode, uint16 opNum, uint16 opValue)
-{
-	switch ((opcode >> (14-opNum*2)) & 0x3)
-	{
-		case ADDR_MODE_REG:
-			if (opValue < MAX_REGS)
-				return(m_regs[opValue]);		// mov reg, *reg*
-			else
-				return(0);
-		case ADDR_MODE_DNA_DIRECT:
-			if (opValue < MAX_DNA)
-				return(m_dna[opValue]);			// mov reg, *mem[const]*
-			else
-				return(0);
-		case ADDR_MODE_IMMED:					
-			return(opValue);					// mov reg, *const*
-		case ADDR_MODE_DNA_INDEXED_DIRECT:			
-			{
-				uint16 reg = m_regs[opValue >> 12];		// reg is upper 4 bits of word; constrained to 0-15
-				uint16 off = (opValue & OFFSET_MASK);	// offset if lower 12 bits of word
-				uint16 highBit = (opcode & (1 << (11-opNum)))?OFFSET_TOP_BIT_MASK:0;
-				off |= highBit;
-				if (off & OFFSET_TOP_BIT_MASK)	// negative!
-					off |= 0xF000;				// extend sign bits
-
-				uint16 dnaOffset = (uint16)(reg + (sint16)off);
-
-				if (dnaOffset < MAX_DNA)
-					return(m_dna[dnaOffset]);	// mov reg, *m[reg+10]* 
-				else
-					return(0);
-			}
-		default:
-			return(0);
-	}
-}
-
-void Organism::setValue(uint16 opcode, uint16 opNum, uint16 opValue, uint16 value)
-{
-	switch ((opcode >> (14-opNum*2)) & 0x3)
-	{
-		case ADDR_MODE_REG:
-			if (opValue < MAX_REGS)
-				m_regs[opValue] = value;
-			break;
-		case ADDR_MODE_DNA_DIRECT:
-			if (opValue < MAX_DNA)
-				m_dna[opValue] = value;
-			break;
-		case ADDR_MODE_IMMED:
-			// nop
-			break;
-		case ADDR_MODE_DNA_INDEXED_DIRECT:
-			{
-				uint16 reg = m_regs[opValue >> 12];		// reg is upper 4 bits of word
-				uint16 off = (opValue & OFFSET_MASK);	// offset if lower 12 bits of word
-				uint16 highBit = (opcode & (1 << (11-opNum)))?OFFSET_TOP_BIT_MASK:0;
-				off |= highBit;
-				if (off & OFFSET_TOP_BIT_MASK)	// negative!
-					off |= 0xF000;				// extend sign bits
-
-				uint16 dnaOffset = (uint16)(reg + (sint16)off);
-
-				if (dnaOffset < MAX_DNA)
-					m_dna[dnaOffset] = value;		// mov *m[reg+10]*, immed
-			}
-	}
-}
-
-bool Organism::execInstr(void)
-{
-	if (m_energy <= 0)
-		return(false);
-
-	validateIP();
-
-	debug();
-
-	bool updateIP = true;
-	OPCODE oc = (OPCODE)(m_dna[m_ip] & OPCODE_MASK);
-
-
-	switch (oc)
-	{
-		case OPCODE_MOV:	
-			mov();
-			break;
-		case OPCODE_PUSH:
-			push();
-			break;
-		case OPCODE_POP:
-			pop();
-			break;
-		case OPCODE_CALL:
-			call(updateIP);
-			break;
-		case OPCODE_RET:
-			ret(updateIP);
-			break;
-		case OPCODE_JMP:
-			jmp(updateIP);
-			break;
-		case OPCODE_JL:
-			jl(updateIP);
-			break;
-		case OPCODE_JLE:
-			jle(updateIP);
-			break;
-		case OPCODE_JG:
-			jg(updateIP);
-			break;
-		case OPCODE_JGE:
-			jge(updateIP);
-			break;
-		case OPCODE_JE:
-			je(updateIP);
-			break;
-		case OPCODE_JNE:
-			jne(updateIP);
-			break;
-		case OPCODE_JS:
-			js(updateIP);
-			break;
-		case OPCODE_JNS:
-			jns(updateIP);
-			break;
-		case OPCODE_ADD:
-			add();
-			break;
-		case OPCODE_SUB:
-			sub();
-			break;
-		case OPCODE_MULT:
-			mult();
-			break;
-		case OPCODE_DIV:
-			div();
-			break;
-		case OPCODE_MOD:
-			mod();
-			break;
-		case OPCODE_AND:
-			andOp();
-			break;
-		case OPCODE_OR:
-			orOp();
-			break;
-		case OPCODE_XOR:
-			xorOp();
-			break;
-		case OPCODE_CMP:
-			cmp();
-			break;
-		case OPCODE_TEST:
-			test();
-			break;
-		case OPCODE_GETXY:
-			getxy();
-			break;
-		case OPCODE_ENERGY:
-			energy();
-			break;
-		case OPCODE_TRAVEL:
-			travel();
-			break;
-		case OPCODE_SHL:
-			shl();
-			break;
-		case OPCODE_SHR:
-			shr();
-			break;
-		case OPCODE_SENSE:
-			sense();
-			break;
-		case OPCODE_EAT:
-			eat();
-			break;
-		case OPCODE_RAND:
-			randNum();
-			break;
-		case OPCODE_PEEK:
-			peek();
-			break;
-		case OPCODE_POKE:
-			poke();
-			break;
-		case OPCODE_RELEASE:
-			release();
-			break;
-		case OPCODE_CHARGE:
-			charge();
-			break;
-		case OPCODE_CKSUM:
-			cksum();
-			break;
-		default:
-			// treat as a nop
-			break;
-	}
-
-	m_energy -= COMPUTE_ENERGY;
-
-	// update the IP
-	if (updateIP == true)
-		m_ip += INSTR_SLOTS;
-
-	return(true);
-}
-
-void Organism::mov(void)
-{
-	// mov dest, src
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],getValue(m_dna[m_ip],1,m_dna[m_ip+2]));
-}
-
-void Organism::add(void)
-{
-	uint16 operand1, operand2;
-
-	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
-
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1+operand2);
-}
-
-void Organism::sub(void)
-{
-	uint16 operand1, operand2;
-
-	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
-
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1-operand2);
-}
-
-void Organism::mult(void)
-{
-	uint16 operand1, operand2;
-
-	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
-
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1*operand2);
-}
-
-void Organism::div(void)
-{
-	uint16 operand1, operand2;
-
-	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
-
-	if (operand2 == 0)
-		return;
-
-	uint32 result = (uint32)operand1/(uint32)operand2;
-
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],(uint16)result);
-}
-
-void Organism::mod(void)
-{
-	uint16 operand1, operand2;
-
-	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
-
-	if (operand2 == 0)
-		return;
-
-	uint16 result = (uint16)((uint32)operand1%(uint32)operand2);
-
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],result);
-}
-
-void Organism::andOp(void)
-{
-	uint16 operand1, operand2;
-
-	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
-
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1&operand2);
-}
-
-void Organism::orOp(void)
-{
-	uint16 operand1, operand2;
-
-	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
-
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1|operand2);
-}
-
-void Organism::xorOp(void)
-{
-	uint16 operand1, operand2;
-
-	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
-
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1^operand2);
-}
-
-void Organism::shl(void)
-{
-	uint16 operand1, operand2;
-
-	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
-
-	if (operand2 > 16)
-		operand2 = 16;
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1 << operand2);
-}
-
-void Organism::shr(void)
-{
-	uint16 operand1, operand2;
-
-	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
-
-	if (operand2 > 16)
-		operand2 = 16;
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1 >> operand2);
-}
-
-// only test and cmp actually set flags
-void Organism::test(void)
-{
-	uint16 operand1, operand2;
-
-	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
-
-	if ((operand1 & operand2) == 0)
-		m_regs[FLAGS_REG] = FLAG_EQUAL;
-	else
-		m_regs[FLAGS_REG] = 0;
-}
-
-void Organism::cmp(void)
-{
-	uint16 operand1, operand2;
-
-	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
-
-	m_regs[FLAGS_REG] = 0;
-
-	if (operand1 < operand2)
-		m_regs[FLAGS_REG] |= FLAG_LESS;
-	else if (operand1 > operand2)
-		m_regs[FLAGS_REG] |= FLAG_GREATER;
-	else if (operand1 == operand2)
-		m_regs[FLAGS_REG] |= FLAG_EQUAL;
-}
-
-void Organism::jmp(bool &updateIP)
-{
-	uint16 delta = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	if (m_dna[m_ip] >> 14 == ADDR_MODE_IMMED)
-		m_ip = m_ip + delta;
-	else
-		m_ip = delta;
-	updateIP = false;
-}
-
-void Organism::jl(bool &updateIP)
-{
-	if (m_regs[FLAGS_REG] & FLAG_LESS)
-		jmp(updateIP);
-	// else do nothing 
-}
-
-void Organism::jle(bool &updateIP)
-{
-	if (m_regs[FLAGS_REG] & (FLAG_LESS|FLAG_EQUAL))
-		jmp(updateIP);
-	// else do nothing 
-}
-
-void Organism::jg(bool &updateIP)
-{
-	if (m_regs[FLAGS_REG] & FLAG_GREATER)
-		jmp(updateIP);
-	// else do nothing 
-}
-
-void Organism::jge(bool &updateIP)
-{
-	if (m_regs[FLAGS_REG] & (FLAG_GREATER|FLAG_EQUAL))
-		jmp(updateIP);
-	// else do nothing 
-}
-
-void Organism::je(bool &updateIP)
-{
-	if (m_regs[FLAGS_REG] & FLAG_EQUAL)
-		jmp(updateIP);
-	// else do nothing 
-}
-
-void Organism::jne(bool &updateIP)
-{
-	if ((m_regs[FLAGS_REG] & FLAG_EQUAL) == 0)
-		jmp(updateIP);
-	// else do nothing 
-}
-
-void Organism::js(bool &updateIP)
-{
-	if (m_regs[FLAGS_REG] & FLAG_SUCCESS)
-		jmp(updateIP);
-	// else do nothing 
-}
-
-void Organism::jns(bool &updateIP)
-{
-	if (!(m_regs[FLAGS_REG] & FLAG_SUCCESS))
-		jmp(updateIP);
-	// else do nothing 
-}
-
-void Organism::internalPush(uint16 value)
-{
-	// predecrement then internalPush
-
-	--m_regs[SP_REG];
-	if (m_regs[SP_REG] >= MAX_DNA)
-	{
-		m_regs[SP_REG] = MAX_DNA-1;			// error! sp was corrupted. help the poor fool
-	}
-	m_dna[m_regs[SP_REG]] = value;
-}
-
-uint16 Organism::internalPop()
-{
-	// get value then postdecrement
-	uint16 val = 0;
-
-	if (m_regs[SP_REG] < MAX_DNA)
-		val = m_dna[m_regs[SP_REG]];
-	else
-		m_regs[SP_REG] = MAX_DNA-1;		// error! sp was corrupted. help the poor fool
-
-	++m_regs[SP_REG];
-	return(val);
-}
-
-void Organism::call(bool &updateIP)
-{
-	// call dest
-	// validation will occur at next iteration
-	internalPush(m_ip + INSTR_SLOTS);	// internalPush next IP address on the stack to return to
-	uint16 delta = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	if (m_dna[m_ip] >> 14 == ADDR_MODE_IMMED)
-		m_ip = m_ip + delta;
-	else
-		m_ip = delta;
-	updateIP = false;		// don't update IP
-}
-
-void Organism::ret(bool &updateIP)
-{
-	m_ip = internalPop();
-	updateIP = false;		// don't update IP
-}
-
-void Organism::nop(void)
-{
-	// don't do anything
-}
-
-void Organism::randNum(void)
-{
-	uint16 operand2;
-
-	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
-
-	if (operand2 == 0)
-		return;
-
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],(uint16)(myrand() % operand2));
-}
-
-void Organism::getxy(void)
-{
-	// place x,y in two specified operands
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],m_x);
-	setValue(m_dna[m_ip],1,m_dna[m_ip+2],m_y);
-}
-
-void Organism::energy(void)
-{
-	// store energy into specified operand
-
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],(uint16)m_energy);
-}
-
-void Organism::validateIP(void)
-{
-	if (m_ip % INSTR_SLOTS != 0)
-	{
-		m_ip /= INSTR_SLOTS;
-		++m_ip;
-		m_ip *= INSTR_SLOTS;
-	}
-
-	if (m_ip > MAX_DNA-INSTR_SLOTS)
-		m_ip = START_IP;
-}
-
-void Organism::mutate(void)
-{
-	if (m_noMutate == false)
-		m_dna[myrand() % MAX_DNA] ^= myrand() % 65536;
-}
-
-void Organism::poke(void)	// direction, their slot#; sets slot of other to r0 (POKE_REG)
-{
-	uint16 newX, newY;
-	uint16 dir = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-
-	if (newXY(dir,&newX,&newY) == false)
-	{
-		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-		return;
-	}
-
-	Organism *other = m_world->occupied(newX,newY);
-	if (other == NULL)
-	{
-		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-		return;
-	}
-	else
-	{
-		if (other->setDNAValue(getValue(m_dna[m_ip],1,m_dna[m_ip+2]),m_regs[POKE_REG]) == true)
-			m_regs[FLAGS_REG] |= FLAG_SUCCESS;
-		else
-			m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-	}
-}
-
-void Organism::peek(void)	// direction/result, slot#
-{
-	uint16 newX, newY;
-	uint16 dir = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-
-	if (newXY(dir,&newX,&newY) == false)
-	{
-		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-		return;
-	}
-
-	Organism *other = m_world->occupied(newX,newY);
-	if (other == NULL)
-	{
-		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-		return;
-	}
-	else
-	{
-		uint16 result;
-		if (other->getDNAValue(getValue(m_dna[m_ip],1,m_dna[m_ip+2]),result) == true)
-		{
-			setValue(m_dna[m_ip],0,m_dna[m_ip+1],result);
-			m_regs[FLAGS_REG] |= FLAG_SUCCESS;
-		}
-		else
-		{
-			m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-		}
-	}
-}
-
-void Organism::push(void)
-{
-	internalPush(getValue(m_dna[m_ip],0,m_dna[m_ip+1]));
-}
-
-void Organism::pop(void)
-{
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],internalPop());
-}
-
-void Organism::release(void)
-{
-	uint16 energyToRelease = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	if (energyToRelease > m_energy || energyToRelease <= 0)
-	{
-		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-		return;
-	}
-
-	if (m_world->generatePower(this,energyToRelease) == true)
-	{
-		m_regs[FLAGS_REG] |= FLAG_SUCCESS;
-	}
-	else
-	{
-		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-	}
-
-	// releases either way!
-	m_energy -= energyToRelease;
-}
-
-void Organism::cksum(void)
-{
-	uint16 operand1, operand2, total = 0;
-
-	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
-
-	if (operand1 >= MAX_DNA || operand2 > MAX_DNA || operand1 > operand2)
-		return;
-
-	for (uint16 i=operand1;i<operand2;i++)
-		total = total + m_dna[i];
-
-	setValue(m_dna[m_ip],0,m_dna[m_ip+1],total);
-}
-
-void Organism::charge(void)
-{
-	uint16 newX, newY;
-	uint16 dir = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
-	uint16 energyAmount = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
-
-	if (energyAmount > m_energy)
-	{
-		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-		return;
-	}
-
-	if (newXY(dir,&newX,&newY) == false)
-	{
-		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-		return;
-	}
-
-	Organism *other = m_world->occupied(newX,newY);
-	if (other == NULL)
-	{
-		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-		return;
-	}
-
-	if (other->increaseEnergy(energyAmount) == true)
-	{
-		m_regs[FLAGS_REG] |= FLAG_SUCCESS;
-		m_energy -= energyAmount;
-	}
-	else
-	{
-		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
-	}
-}
-
-bool Organism::increaseEnergy(uint16 energyAmt)
-{
-	uint32 newTotal = m_energy;
-	newTotal += energyAmt;
-	if (newTotal < MAX_ORGANISM_ENERGY)
-	{
-		m_energy += energyAmt;
-		return(true);
-	}
-
-	return(false);
-}
-
-
-
-void Organism::getDisplayLines(vector<string> &lines)
-{
-	string shortName = m_botName.substr(0,5);
-
-	lines.clear();
-
-	char temp[256];
-	char flags[16] = {0};
-	if (m_regs[FLAGS_REG]&FLAG_EQUAL)
-		strcat(flags,"e");
-	if (m_regs[FLAGS_REG]&FLAG_LESS)
-		strcat(flags,"l");
-	if (m_regs[FLAGS_REG]&FLAG_GREATER)
-		strcat(flags,"g");
-	if (m_regs[FLAGS_REG]&FLAG_SUCCESS)
-		strcat(flags,"s");
-
-	char orgChar = (char)m_organismID;
-	if (orgChar < 26)
-		orgChar += 'A';
-	else
-		orgChar = orgChar - 26 + 'a';
-
-	sprintf(temp,"(%s %c) x=%d, y=%d, energy=%d, IP=%d, SP=%d, flags=%s",
-			shortName.c_str(),
-			orgChar,
-			m_x,m_y,
-			m_energy,
-			m_ip,
-			m_regs[SP_REG],
-			flags
-			);
-	lines.push_back(temp);
-
-	sprintf(temp,"R00=%5d R01=%5d R02=%5d R03=%5d R04=%5d R05=%5d R06=%5d",
-		m_regs[0],
-		m_regs[1],
-		m_regs[2],
-		m_regs[3],
-		m_regs[4],
-		m_regs[5],
-		m_regs[6]);
-	lines.push_back(temp);
-	sprintf(temp,"R07=%5d R08=%5d R09=%5d R10=%5d R11=%5d R12=%5d R13=%5d",
-		m_regs[7],
-		m_regs[8],
-		m_regs[9],
-		m_regs[10],
-		m_regs[11],
-		m_regs[12],
-		m_regs[13]);
-	lines.push_back(temp);
-
-	sprintf(temp,"%s",
-			m_disasm->getCurrentLine(m_ip).c_str());
-	lines.push_back(temp);
-}
-
-void Organism::debug()
-{
-	if (m_singleStep == false && m_debugStream == NULL)
-		return;
-
-	vector<string> lines;
-	getDisplayLines(lines);
-
-	if (m_debugStream != NULL)
-	{
-		for (unsigned int i=0;i<lines.size();i++)
-			fprintf(m_debugStream,"%s\n",lines[i].c_str());
-		fprintf(m_debugStream,"\n");
-	}
-
-	if (m_singleStep == true)
-		singleStep(lines);
-}
-
-void Organism::singleStep(std::vector<std::string> &lines)
-{
-	if (m_traceCount > 1)
-	{
-		--m_traceCount;
-		return;
-	}
-	else if (m_goUntilIP != INVALID_IP)
-	{
-		if (m_ip != m_goUntilIP)
-			return;
-		else
-		{
-			m_goUntilIP = INVALID_IP;
-			m_world->setQuiet(false);
-			m_world->redrawAll();
-			m_world->showDisplay();
-		}
-	}
-
-	m_traceCount = 0;
-	
-	for(;;)
-	{
-		for (unsigned int i=0;i<lines.size();i++)
-		{
-			m_console->gotoXY(STATUS_X,STATUS_Y+i);
-			m_console->printStringOverwrite(lines[i].c_str());
-		}
-		m_console->gotoXY(PROMPT_X,PROMPT_Y);
-		string prompt = "(u)nasm,(g)o,(s)ilentGo,(d)mp,(e)dt,(r)eg,(i)p,(q)uit,##, or [Enter]: ";
-		m_console->printStringOverwrite(prompt);
-		m_console->gotoXY(PROMPT_X+prompt.size(),PROMPT_Y);
-		string result = m_console->getString();
-
-		if (result.length() == 0)
-		{
-			// user hit enter
-
-			return;
-		}
-		
-		switch (toupper(result[0]))
-		{
-			case 'U':
-				if (result.length() == 1)
-					printDisassembly(m_ip);
-				else
-					printDisassembly((uint16)atoi(result.c_str() + 1));
-				m_world->redrawAll();
-				break;
-			case 'G':
-			case 'S':
-				if (result.length() == 1)
-					m_goUntilIP = GO_INDEFINITELY_IP;
-				else
-					m_goUntilIP = (uint16)atoi(result.c_str()+1);
-
-				if (toupper(result[0]) == 'S')
-					m_world->setQuiet(true);
-
-				// adjust to valid IP
-				while (m_goUntilIP % INSTR_SLOTS)
-					m_goUntilIP = (m_goUntilIP + 1) % MAX_DNA;
-				return;
-
-			case 'D':
-				if (result.length() == 1)
-					printData(m_ip);
-				else				
-					printData((uint16)atoi(result.c_str()+1));
-				m_world->redrawAll();
-				break;
-			case 'E':
-				editData(result);
-				break;
-			case 'I':
-				m_ip = (uint16)atoi(result.c_str()+1);
-				validateIP();
-				break;
-			case 'R':
-				editRegister(result);
-				break;
-			case 'Q':
-				m_world->terminate();
-				return;
-			default:
-				if (isdigit(result[0]))
-				{
-					m_traceCount = atoi(result.c_str());
-					return;
-				}
-				break;
-		}
-
-		getDisplayLines(lines);
-	}
-}
-
-void Organism::editData(const std::string &data)
-{
-	unsigned int off, val;
-
-	if (sscanf(data.c_str() + 1, "%u %u", &off, &val) && off < MAX_DNA)
-		m_dna[(uint16)off] = (uint16)val;
-}
-
-void Organism::editRegister(const std::string &data)
-{
-	unsigned int off, val;
-
-	if (sscanf(data.c_str() + 1, "%u %u", &off, &val) && off < MAX_REGS)
-		m_regs[(uint16)off] = (uint16)val;
-}
-
-void Organism::printDisassembly(uint16 start)
-{
-	std::vector<std::string> v;
-	m_disasm->getDisassembly(v, start, start + UNASSEMBLE_LINES * INSTR_SLOTS);
-
-	unsigned int i;
-	for (i = 0; i < v.size(); i++)
-	{
-		m_console->gotoXY(STATUS_X, i + START_Y);
-		m_console->printStringOverwrite(v[i]);
-	}
-	for (; i < UNASSEMBLE_LINES; i++)
-	{
-		m_console->gotoXY(STATUS_X, i + START_Y);
-		m_console->printStringOverwrite("");
-	}
-}
-
-void Organism::printData(uint16 start)
-{
-	uint16 lineNum = 0;
-
-	for (uint16 i=start; lineNum < DATA_LINES && i < MAX_DNA; i++)
-	{
-		char temp[256];
-
-		m_console->gotoXY(STATUS_X,lineNum + START_Y);
-		sprintf(temp,"%04d: %5d (%04X)",i,m_dna[i],m_dna[i]);
-		m_console->printStringOverwrite(temp);
-		lineNum++;
-	}
-	for (; lineNum < DATA_LINES; lineNum++) {
-		m_console->gotoXY(STATUS_X, lineNum + START_Y);
-		m_console->printStringOverwrite("");
-	}
-}
-
-
-bool Organism::setXY(uint16 x, uint16 y)
-{
-	if (x <= GRID_WIDTH && y <= GRID_HEIGHT)
-	{
-		m_x = x;
-		m_y = y;
-		m_oldX = m_x;
-		m_oldY = m_y;
-		return(true);
-	}
-	return(false);
-}
+//----------------------------------------------------------------------------
+//
+// organism.cpp
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer. 
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution. 
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission. 
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#endif // #ifdef WIN32
+
+#include "world.h"
+#include "organism.h"
+#include "disasm.h"
+#include "mycon.h"
+
+#include <string>
+#include <cstring>
+#include <ctime>
+#include <cstdlib>
+#include <cstdio>
+#include <cctype>
+
+using namespace std;
+
+Organism::Organism
+(
+	World *world, 
+	uint16  *myDNA, 
+	uint16 dnaSize,
+	uint32 startEnergy, 
+	uint16 organismID,
+	bool singleStep,
+	const std::string & moduleInfo, 
+	TraceWriter *trace, 
+	bool noMutate,
+	CConsole *console
+)
+{
+	m_ip = START_IP;
+	m_world = world;
+	m_energy = startEnergy;
+	memset(&m_ledger,0,sizeof(m_ledger));
+	m_ledger.start = m_energy;
+	m_hashing = false;
+	m_dnaHash = 0;
+	m_watchEnergy = false;
+	m_energyRead = false;
+	m_energyLow = 0;
+	m_energyHigh = 0;
+	m_asleep = false;
+	m_sleepTick = 0;
+	m_sleepEnergy = 0;
+	m_sleepPeriod = 0;
+	m_noMutate = noMutate;
+	m_moduleInfo = moduleInfo;
+	m_organismID = organismID;
+	m_x = INVALID_COORD;
+	m_y = INVALID_COORD;
+	m_singleStep = singleStep;
+	m_goUntilIP = INVALID_IP;
+	m_traceCount = 0;
+	m_stopAtTick = INVALID_TICK;
+	m_historyStart = 0;
+
+	m_console = console;
+
+	// bot name
+
+	int spaceOff = m_moduleInfo.find_first_of(" ,\t");
+	if (spaceOff != -1)
+		m_botName = m_moduleInfo.substr(0,spaceOff);
+	else
+		m_botName = m_moduleInfo;
+
+
+	uint32 i;
+	// set DNA
+	for (i=0;i<dnaSize && i < MAX_DNA;i++)
+		m_dna[i] = myDNA[i];
+	// clear out remainder of DNA
+	for (i=dnaSize;i < MAX_DNA;i++)
+		m_dna[i] = 0;
+	for (i=0;i<MAX_REGS;i++)
+		m_regs[i] = 0;
+	m_regs[SP_REG] = MAX_DNA;		// predecrement then internalPush
+
+	m_disasm = new DisAsm(m_dna,m_regs);
+
+	m_trace = trace;
+	m_profile = NULL;
+	m_debugHooks = m_singleStep || m_trace != NULL;
+	m_poked = false;
+	m_watches = NULL;
+	resetProbe();
+}
+
+Organism::~Organism()
+{
+	if (m_disasm != NULL)
+		delete m_disasm;
+
+	if (m_watches != NULL)
+		delete m_watches;
+}
+
+
+bool Organism::alive(void)
+{
+	return(m_energy > 0);
+}
+
+void Organism::travel(void)
+{
+	// op1 = direction, op2 = result register
+
+	uint16 newX, newY;
+	uint16 dir = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+
+	if (newXY(dir,&newX,&newY) == false || m_world->occupied(newX,newY) != NULL)
+	{
+		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+		m_ledger.failedTravels++;
+	}
+	else
+	{
+		m_world->markCell(m_x,m_y);
+		m_world->markCell(newX,newY);
+		m_x = newX;
+		m_y = newY;
+		m_regs[FLAGS_REG] |= FLAG_SUCCESS;
+		m_energy -= TRAVEL_ENERGY;
+		m_ledger.travel += TRAVEL_ENERGY;
+		if (m_profile != NULL)
+			m_profile->addEnergy(m_organismID,m_ip,TRAVEL_ENERGY);
+	}
+}
+
+
+void Organism::eat(void)
+{
+	energyAtLeast(MAX_ORGANISM_ENERGY-FOOD_ENERGY+1,m_energy + FOOD_ENERGY > MAX_ORGANISM_ENERGY);
+	if (m_energy + FOOD_ENERGY > MAX_ORGANISM_ENERGY)
+	{
+		// too full!
+		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+		return;
+	}
+
+	if (m_world->eatFood(this,m_x,m_y) == true)
+	{
+		m_regs[FLAGS_REG] |= FLAG_SUCCESS;
+		m_energy += FOOD_ENERGY;
+		m_ledger.food += FOOD_ENERGY;
+	}
+	else
+		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+}
+
+void Organism::sense(void)		// sense food on current square; id put in operand1
+{
+	uint16 result = m_world->getFoodID(m_x,m_y);
+
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],result);
+	if (result != 0)
+		m_regs[FLAGS_REG] |= FLAG_SUCCESS;
+	else
+		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+}
+
+uint32 Organism::getEnergy(void)
+{
+	sync();
+	return(m_energy);
+}
+
+bool Organism::getDNAValue(uint16 slot, uint16 & value)
+{
+	if (slot >= MAX_DNA)
+		return(false);
+	value = m_dna[slot];
+	return(true);
+}
+
+bool Organism::setDNAValue(uint16 slot, uint16 value)
+{
+	if (slot >= MAX_DNA)
+		return (false);
+	wake();
+	storeDNA(slot,value,true);
+	m_poked = true;			// only ever called on behalf of a neighbour's poke
+	return(true);
+}
+
+
+
+bool Organism::newXY(uint16 dir, uint16 *newX, uint16 *newY)
+{
+	*newX = m_x;
+	*newY = m_y;
+
+	switch (dir % 4)
+	{
+		case DIR_NORTH:
+			(*newY)--;
+			break;
+		case DIR_SOUTH:
+			(*newY)++;
+			break;
+		case DIR_EAST:
+			(*newX)++;
+			break;
+		case DIR_WEST:
+			(*newX)--;
+			break;
+		default:
+			return(false);
+	}
+
+	return(*newX < GRID_WIDTH && *newY < GRID_HEIGHT);
+}
+
+uint32 Organism::oppositeDir(uint32 dir)
+{
+	return(3-(dir%4));
+}
+
+// operand #0: bit 14-15: 00=register, 01=memory, 10=constant
+// operand #1: bit 12-13: 00=register, 01=memory, 10=constant
+// operand #2: bit 10-11: 00=register, 01=memory, 10=constant
+
+uint16 Organism::getValue(uint16 opcode, uint16 opNum, uint16 opValue)
+{
+	switch ((opcode >> (14-opNum*2)) & 0x3)
+	{
+		case ADDR_MODE_REG:
+			if (opValue < MAX_REGS)
+				return(m_regs[opValue]);		// mov reg, *reg*
+			else
+				return(0);
+		case ADDR_MODE_DNA_DIRECT:
+			if (opValue < MAX_DNA)
+				return(m_dna[opValue]);			// mov reg, *mem[const]*
+			else
+				return(0);
+		case ADDR_MODE_IMMED:					
+			return(opValue);					// mov reg, *const*
+		case ADDR_MODE_DNA_INDEXED_DIRECT:			
+			{
+				uint16 reg = m_regs[opValue >> 12];		// reg is upper 4 bits of word; constrained to 0-15
+				uint16 off = (opValue & OFFSET_MASK);	// offset if lower 12 bits of word
+				uint16 highBit = (opcode & (1 << (11-opNum)))?OFFSET_TOP_BIT_MASK:0;
+				off |= highBit;
+				if (off & OFFSET_TOP_BIT_MASK)	// negative!
+					off |= 0xF000;				// extend sign bits
+
+				uint16 dnaOffset = (uint16)(reg + (sint16)off);
+
+				if (dnaOffset < MAX_DNA)
+					return(m_dna[dnaOffset]);	// mov reg, *m[reg+10]* 
+				else
+					return(0);
+			}
+		default:
+			return(0);
+	}
+}
+
+void Organism::setValue(uint16 opcode, uint16 opNum, uint16 opValue, uint16 value)
+{
+	switch ((opcode >> (14-opNum*2)) & 0x3)
+	{
+		case ADDR_MODE_REG:
+			if (opValue < MAX_REGS)
+				m_regs[opValue] = value;
+			break;
+		case ADDR_MODE_DNA_DIRECT:
+			if (opValue < MAX_DNA)
+				storeDNA(opValue,value);
+			break;
+		case ADDR_MODE_IMMED:
+			// nop
+			break;
+		case ADDR_MODE_DNA_INDEXED_DIRECT:
+			{
+				uint16 reg = m_regs[opValue >> 12];		// reg is upper 4 bits of word
+				uint16 off = (opValue & OFFSET_MASK);	// offset if lower 12 bits of word
+				uint16 highBit = (opcode & (1 << (11-opNum)))?OFFSET_TOP_BIT_MASK:0;
+				off |= highBit;
+				if (off & OFFSET_TOP_BIT_MASK)	// negative!
+					off |= 0xF000;				// extend sign bits
+
+				uint16 dnaOffset = (uint16)(reg + (sint16)off);
+
+				if (dnaOffset < MAX_DNA)
+					storeDNA(dnaOffset,value);		// mov *m[reg+10]*, immed
+			}
+	}
+}
+
+bool Organism::execInstr(void)
+{
+	if (m_energy <= 0)
+		return(false);
+
+	validateIP();
+
+	if (m_debugHooks)
+	{
+		PhaseProfile *phases = m_world->getPhases();
+		if (phases != NULL && phases->sample(PHASE_DEBUG))
+		{
+			uint64 start = PhaseProfile::now();
+			debug();
+			phases->addSample(PHASE_DEBUG,start);
+		}
+		else
+			debug();
+	}
+
+	bool updateIP = true;
+	OPCODE oc = (OPCODE)(m_dna[m_ip] & OPCODE_MASK);
+
+
+	switch (oc)
+	{
+		case OPCODE_MOV:	
+			mov();
+			break;
+		case OPCODE_PUSH:
+			push();
+			break;
+		case OPCODE_POP:
+			pop();
+			break;
+		case OPCODE_CALL:
+			call(updateIP);
+			break;
+		case OPCODE_RET:
+			ret(updateIP);
+			break;
+		case OPCODE_JMP:
+			jmp(updateIP);
+			break;
+		case OPCODE_JL:
+			jl(updateIP);
+			break;
+		case OPCODE_JLE:
+			jle(updateIP);
+			break;
+		case OPCODE_JG:
+			jg(updateIP);
+			break;
+		case OPCODE_JGE:
+			jge(updateIP);
+			break;
+		case OPCODE_JE:
+			je(updateIP);
+			break;
+		case OPCODE_JNE:
+			jne(updateIP);
+			break;
+		case OPCODE_JS:
+			js(updateIP);
+			break;
+		case OPCODE_JNS:
+			jns(updateIP);
+			break;
+		case OPCODE_ADD:
+			add();
+			break;
+		case OPCODE_SUB:
+			sub();
+			break;
+		case OPCODE_MULT:
+			mult();
+			break;
+		case OPCODE_DIV:
+			div();
+			break;
+		case OPCODE_MOD:
+			mod();
+			break;
+		case OPCODE_AND:
+			andOp();
+			break;
+		case OPCODE_OR:
+			orOp();
+			break;
+		case OPCODE_XOR:
+			xorOp();
+			break;
+		case OPCODE_CMP:
+			cmp();
+			break;
+		case OPCODE_TEST:
+			test();
+			break;
+		case OPCODE_GETXY:
+			getxy();
+			break;
+		case OPCODE_ENERGY:
+			energy();
+			break;
+		case OPCODE_TRAVEL:
+			travel();
+			break;
+		case OPCODE_SHL:
+			shl();
+			break;
+		case OPCODE_SHR:
+			shr();
+			break;
+		case OPCODE_SENSE:
+			sense();
+			break;
+		case OPCODE_EAT:
+			eat();
+			break;
+		case OPCODE_RAND:
+			randNum();
+			break;
+		case OPCODE_PEEK:
+			peek();
+			break;
+		case OPCODE_POKE:
+			poke();
+			break;
+		case OPCODE_RELEASE:
+			release();
+			break;
+		case OPCODE_CHARGE:
+			charge();
+			break;
+		case OPCODE_CKSUM:
+			cksum();
+			break;
+		default:
+			// treat as a nop
+			break;
+	}
+
+	m_energy -= COMPUTE_ENERGY;
+	if (m_energy <= 0)
+		m_world->markCell(m_x,m_y);		// shown dead from the next frame
+
+	// update the IP
+	if (updateIP == true)
+		m_ip += INSTR_SLOTS;
+
+	return(true);
+}
+
+void Organism::mov(void)
+{
+	// mov dest, src
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],getValue(m_dna[m_ip],1,m_dna[m_ip+2]));
+}
+
+void Organism::add(void)
+{
+	uint16 operand1, operand2;
+
+	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
+
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1+operand2);
+}
+
+void Organism::sub(void)
+{
+	uint16 operand1, operand2;
+
+	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
+
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1-operand2);
+}
+
+void Organism::mult(void)
+{
+	uint16 operand1, operand2;
+
+	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
+
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1*operand2);
+}
+
+void Organism::div(void)
+{
+	uint16 operand1, operand2;
+
+	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
+
+	if (operand2 == 0)
+		return;
+
+	uint32 result = (uint32)operand1/(uint32)operand2;
+
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],(uint16)result);
+}
+
+void Organism::mod(void)
+{
+	uint16 operand1, operand2;
+
+	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
+
+	if (operand2 == 0)
+		return;
+
+	uint16 result = (uint16)((uint32)operand1%(uint32)operand2);
+
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],result);
+}
+
+void Organism::andOp(void)
+{
+	uint16 operand1, operand2;
+
+	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
+
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1&operand2);
+}
+
+void Organism::orOp(void)
+{
+	uint16 operand1, operand2;
+
+	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
+
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1|operand2);
+}
+
+void Organism::xorOp(void)
+{
+	uint16 operand1, operand2;
+
+	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
+
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1^operand2);
+}
+
+void Organism::shl(void)
+{
+	uint16 operand1, operand2;
+
+	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
+
+	if (operand2 > 16)
+		operand2 = 16;
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1 << operand2);
+}
+
+void Organism::shr(void)
+{
+	uint16 operand1, operand2;
+
+	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
+
+	if (operand2 > 16)
+		operand2 = 16;
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],operand1 >> operand2);
+}
+
+// only test and cmp actually set flags
+void Organism::test(void)
+{
+	uint16 operand1, operand2;
+
+	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
+
+	if ((operand1 & operand2) == 0)
+		m_regs[FLAGS_REG] = FLAG_EQUAL;
+	else
+		m_regs[FLAGS_REG] = 0;
+}
+
+void Organism::cmp(void)
+{
+	uint16 operand1, operand2;
+
+	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
+
+	m_regs[FLAGS_REG] = 0;
+
+	if (operand1 < operand2)
+		m_regs[FLAGS_REG] |= FLAG_LESS;
+	else if (operand1 > operand2)
+		m_regs[FLAGS_REG] |= FLAG_GREATER;
+	else if (operand1 == operand2)
+		m_regs[FLAGS_REG] |= FLAG_EQUAL;
+}
+
+void Organism::jmp(bool &updateIP)
+{
+	uint16 delta = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	if (m_dna[m_ip] >> 14 == ADDR_MODE_IMMED)
+		m_ip = m_ip + delta;
+	else
+		m_ip = delta;
+	updateIP = false;
+}
+
+void Organism::jl(bool &updateIP)
+{
+	if (m_regs[FLAGS_REG] & FLAG_LESS)
+		jmp(updateIP);
+	// else do nothing 
+}
+
+void Organism::jle(bool &updateIP)
+{
+	if (m_regs[FLAGS_REG] & (FLAG_LESS|FLAG_EQUAL))
+		jmp(updateIP);
+	// else do nothing 
+}
+
+void Organism::jg(bool &updateIP)
+{
+	if (m_regs[FLAGS_REG] & FLAG_GREATER)
+		jmp(updateIP);
+	// else do nothing 
+}
+
+void Organism::jge(bool &updateIP)
+{
+	if (m_regs[FLAGS_REG] & (FLAG_GREATER|FLAG_EQUAL))
+		jmp(updateIP);
+	// else do nothing 
+}
+
+void Organism::je(bool &updateIP)
+{
+	if (m_regs[FLAGS_REG] & FLAG_EQUAL)
+		jmp(updateIP);
+	// else do nothing 
+}
+
+void Organism::jne(bool &updateIP)
+{
+	if ((m_regs[FLAGS_REG] & FLAG_EQUAL) == 0)
+		jmp(updateIP);
+	// else do nothing 
+}
+
+void Organism::js(bool &updateIP)
+{
+	if (m_regs[FLAGS_REG] & FLAG_SUCCESS)
+		jmp(updateIP);
+	// else do nothing 
+}
+
+void Organism::jns(bool &updateIP)
+{
+	if (!(m_regs[FLAGS_REG] & FLAG_SUCCESS))
+		jmp(updateIP);
+	// else do nothing 
+}
+
+void Organism::internalPush(uint16 value)
+{
+	// predecrement then internalPush
+
+	--m_regs[SP_REG];
+	if (m_regs[SP_REG] >= MAX_DNA)
+	{
+		m_regs[SP_REG] = MAX_DNA-1;			// error! sp was corrupted. help the poor fool
+	}
+	storeDNA(m_regs[SP_REG],value);
+}
+
+uint16 Organism::internalPop()
+{
+	// get value then postdecrement
+	uint16 val = 0;
+
+	if (m_regs[SP_REG] < MAX_DNA)
+		val = m_dna[m_regs[SP_REG]];
+	else
+		m_regs[SP_REG] = MAX_DNA-1;		// error! sp was corrupted. help the poor fool
+
+	++m_regs[SP_REG];
+	return(val);
+}
+
+void Organism::call(bool &updateIP)
+{
+	// call dest
+	// validation will occur at next iteration
+	internalPush(m_ip + INSTR_SLOTS);	// internalPush next IP address on the stack to return to
+	uint16 delta = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	if (m_dna[m_ip] >> 14 == ADDR_MODE_IMMED)
+		m_ip = m_ip + delta;
+	else
+		m_ip = delta;
+	updateIP = false;		// don't update IP
+
+	if (m_profile != NULL)
+		m_profile->onCall(m_organismID,m_ip);
+}
+
+void Organism::ret(bool &updateIP)
+{
+	m_ip = internalPop();
+	updateIP = false;		// don't update IP
+
+	if (m_profile != NULL)
+		m_profile->onRet(m_organismID);
+}
+
+void Organism::nop(void)
+{
+	// don't do anything
+}
+
+void Organism::randNum(void)
+{
+	uint16 operand2;
+
+	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
+
+	if (operand2 == 0)
+		return;
+
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],(uint16)(myrand() % operand2));
+}
+
+void Organism::getxy(void)
+{
+	// place x,y in two specified operands
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],m_x);
+	setValue(m_dna[m_ip],1,m_dna[m_ip+2],m_y);
+}
+
+void Organism::energy(void)
+{
+	// store energy into specified operand
+
+	if (m_watchEnergy)
+		m_energyRead = true;
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],(uint16)m_energy);
+}
+
+void Organism::validateIP(void)
+{
+	if (m_ip % INSTR_SLOTS != 0)
+	{
+		m_ip /= INSTR_SLOTS;
+		++m_ip;
+		m_ip *= INSTR_SLOTS;
+	}
+
+	if (m_ip > MAX_DNA-INSTR_SLOTS)
+		m_ip = START_IP;
+}
+
+void Organism::mutate(void)
+{
+	if (m_noMutate == false)
+	{
+		uint16 bits = myrand() % 65536;		// draw order matters for reproducible runs
+		uint16 slot = myrand() % MAX_DNA;
+		storeDNA(slot,m_dna[slot] ^ bits);
+	}
+}
+
+void Organism::poke(void)	// direction, their slot#; sets slot of other to r0 (POKE_REG)
+{
+	uint16 newX, newY;
+	uint16 dir = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+
+	if (newXY(dir,&newX,&newY) == false)
+	{
+		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+		return;
+	}
+
+	Organism *other = m_world->occupied(newX,newY);
+	if (other == NULL)
+	{
+		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+		return;
+	}
+	else
+	{
+		if (other->setDNAValue(getValue(m_dna[m_ip],1,m_dna[m_ip+2]),m_regs[POKE_REG]) == true)
+			m_regs[FLAGS_REG] |= FLAG_SUCCESS;
+		else
+			m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+	}
+}
+
+void Organism::peek(void)	// direction/result, slot#
+{
+	uint16 newX, newY;
+	uint16 dir = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+
+	if (newXY(dir,&newX,&newY) == false)
+	{
+		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+		return;
+	}
+
+	Organism *other = m_world->occupied(newX,newY);
+	if (other == NULL)
+	{
+		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+		return;
+	}
+	else
+	{
+		uint16 result;
+		if (other->getDNAValue(getValue(m_dna[m_ip],1,m_dna[m_ip+2]),result) == true)
+		{
+			setValue(m_dna[m_ip],0,m_dna[m_ip+1],result);
+			m_regs[FLAGS_REG] |= FLAG_SUCCESS;
+		}
+		else
+		{
+			m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+		}
+	}
+}
+
+void Organism::push(void)
+{
+	internalPush(getValue(m_dna[m_ip],0,m_dna[m_ip+1]));
+}
+
+void Organism::pop(void)
+{
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],internalPop());
+}
+
+void Organism::release(void)
+{
+	uint16 energyToRelease = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	if (energyToRelease > 0)
+		energyAtLeast(energyToRelease,energyToRelease <= m_energy);
+	if (energyToRelease > m_energy || energyToRelease <= 0)
+	{
+		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+		return;
+	}
+
+	if (m_world->generatePower(this,energyToRelease) == true)
+	{
+		m_regs[FLAGS_REG] |= FLAG_SUCCESS;
+		m_ledger.releasedOnPoint += energyToRelease;
+	}
+	else
+	{
+		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+		m_ledger.releasedOffPoint += energyToRelease;
+	}
+
+	// releases either way!
+	m_energy -= energyToRelease;
+}
+
+void Organism::cksum(void)
+{
+	uint16 operand1, operand2, total = 0;
+
+	operand1 = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	operand2 = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
+
+	if (operand1 >= MAX_DNA || operand2 > MAX_DNA || operand1 > operand2)
+		return;
+
+	for (uint16 i=operand1;i<operand2;i++)
+		total = total + m_dna[i];
+
+	setValue(m_dna[m_ip],0,m_dna[m_ip+1],total);
+}
+
+void Organism::charge(void)
+{
+	uint16 newX, newY;
+	uint16 dir = getValue(m_dna[m_ip],0,m_dna[m_ip+1]);
+	uint16 energyAmount = getValue(m_dna[m_ip],1,m_dna[m_ip+2]);
+
+	energyAtLeast(energyAmount,energyAmount <= m_energy);
+	if (energyAmount > m_energy)
+	{
+		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+		return;
+	}
+
+	if (newXY(dir,&newX,&newY) == false)
+	{
+		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+		return;
+	}
+
+	Organism *other = m_world->occupied(newX,newY);
+	if (other == NULL)
+	{
+		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+		return;
+	}
+
+	if (other->increaseEnergy(energyAmount) == true)
+	{
+		m_world->markCell(newX,newY);		// perhaps brought back to life
+		m_regs[FLAGS_REG] |= FLAG_SUCCESS;
+		m_energy -= energyAmount;
+		m_ledger.chargeSent += energyAmount;
+	}
+	else
+	{
+		m_regs[FLAGS_REG] &= ~FLAG_SUCCESS;
+	}
+}
+
+bool Organism::increaseEnergy(uint16 energyAmt)
+{
+	wake();
+
+	uint32 newTotal = m_energy;
+	newTotal += energyAmt;
+	energyAtLeast(MAX_ORGANISM_ENERGY-energyAmt,newTotal >= MAX_ORGANISM_ENERGY);
+	if (newTotal < MAX_ORGANISM_ENERGY)
+	{
+		m_energy += energyAmt;
+		m_ledger.chargeReceived += energyAmt;
+		return(true);
+	}
+
+	return(false);
+}
+
+
+
+void Organism::getDisplayLines(vector<string> &lines)
+{
+	formatDisplayLines(lines,m_botName,m_organismID,m_x,m_y,m_energy,m_ip,m_regs,*m_disasm);
+}
+
+// also used to decode -l traces, so it only looks at what it is given
+
+void Organism::formatDisplayLines
+(
+	std::vector<std::string> &lines,
+	const std::string &botName,
+	uint16 organismID,
+	uint16 x,
+	uint16 y,
+	sint32 energy,
+	uint16 ip,
+	uint16 *regs,
+	DisAsm &disasm
+)
+{
+	string shortName = botName.substr(0,5);
+
+	lines.clear();
+
+	char temp[256];
+	char flags[16] = {0};
+	if (regs[FLAGS_REG]&FLAG_EQUAL)
+		strcat(flags,"e");
+	if (regs[FLAGS_REG]&FLAG_LESS)
+		strcat(flags,"l");
+	if (regs[FLAGS_REG]&FLAG_GREATER)
+		strcat(flags,"g");
+	if (regs[FLAGS_REG]&FLAG_SUCCESS)
+		strcat(flags,"s");
+
+	// clones are known by letter; drones (traced with --trace-orgs) by ID
+	char orgName[16];
+	if (botName == DRONE_STRING)
+		sprintf(orgName,"%d",organismID);
+	else if (organismID < 26)
+		sprintf(orgName,"%c",'A'+organismID);
+	else
+		sprintf(orgName,"%c",'a'+organismID-26);
+
+	sprintf(temp,"(%s %s) x=%d, y=%d, energy=%d, IP=%d, SP=%d, flags=%s",
+			shortName.c_str(),
+			orgName,
+			x,y,
+			energy,
+			ip,
+			regs[SP_REG],
+			flags
+			);
+	lines.push_back(temp);
+
+	sprintf(temp,"R00=%5d R01=%5d R02=%5d R03=%5d R04=%5d R05=%5d R06=%5d",
+		regs[0],
+		regs[1],
+		regs[2],
+		regs[3],
+		regs[4],
+		regs[5],
+		regs[6]);
+	lines.push_back(temp);
+	sprintf(temp,"R07=%5d R08=%5d R09=%5d R10=%5d R11=%5d R12=%5d R13=%5d",
+		regs[7],
+		regs[8],
+		regs[9],
+		regs[10],
+		regs[11],
+		regs[12],
+		regs[13]);
+	lines.push_back(temp);
+
+	disasm.formatCurrentLine(temp,ip);
+	lines.push_back(temp);
+}
+
+void Organism::debug()
+{
+	bool stop = false;
+
+	// the display lines are only built when the debugger stops; while it
+	// runs free this leaves just the stop checks per instruction
+
+	if (m_profile != NULL)
+		m_profile->count(m_organismID,m_ip);
+
+	if (m_singleStep == true)
+		stop = debuggerShouldStop();
+
+	if (m_trace != NULL && m_trace->wants(m_world->getTickNum(),m_ip,m_dna[m_ip]))
+	{
+		TraceState st;
+		st.tick = m_world->getTickNum();
+		st.orgID = m_organismID;
+		st.ip = m_ip;
+		memcpy(st.regs,m_regs,sizeof(m_regs));
+		st.x = m_x;
+		st.y = m_y;
+		st.energy = m_energy;
+		m_trace->record(st,m_dna,m_botName);
+	}
+
+	if (stop == true)
+	{
+		vector<string> lines;
+		getDisplayLines(lines);
+		singleStep(lines);
+	}
+}
+
+void Organism::getWatchState(WatchState &st)
+{
+	st.regs = m_regs;
+	st.dna = m_dna;
+	st.ip = m_ip;
+	st.energy = m_energy;
+	st.x = m_x;
+	st.y = m_y;
+}
+
+bool Organism::debuggerShouldStop(void)
+{
+	bool hit = false;
+	uint32 tick = m_world->getTickNum();
+
+	// remember where we were at each tick for "run back to IP"; a rewind
+	// truncates the history back to the checkpoint being replayed from
+
+	if (m_ipHistory.size() == 0 || tick < m_historyStart)
+	{
+		m_ipHistory.clear();
+		m_historyStart = tick;
+	}
+	m_ipHistory.resize(tick - m_historyStart);
+	m_ipHistory.push_back(m_ip);
+
+	if (m_watches != NULL)
+	{
+		WatchState st;
+		getWatchState(st);
+		hit = m_watches->triggered(st);
+	}
+
+	if (m_stopAtTick != INVALID_TICK)
+	{
+		// replaying: nothing else stops us before the target tick
+		if (tick != m_stopAtTick)
+			return(false);
+		hit = false;
+	}
+	else if (hit == false)
+	{
+		if (m_traceCount > 1)
+		{
+			--m_traceCount;
+			return(false);
+		}
+		else if (m_goUntilIP != INVALID_IP && m_ip != m_goUntilIP)
+			return(false);
+	}
+
+	if (m_goUntilIP != INVALID_IP || m_stopAtTick != INVALID_TICK)
+	{
+		m_goUntilIP = INVALID_IP;
+		m_stopAtTick = INVALID_TICK;
+		m_world->setQuiet(false);
+		m_world->redrawAll();
+		m_world->showDisplay();
+	}
+
+	m_traceCount = 0;
+
+	m_console->gotoXY(STATUS_X,WATCH_Y);
+	m_console->printStringOverwrite(hit ? m_watches->getReason() : "");
+
+	return(true);
+}
+
+void Organism::singleStep(std::vector<std::string> &lines)
+{
+	for(;;)
+	{
+		for (unsigned int i=0;i<lines.size();i++)
+		{
+			m_console->gotoXY(STATUS_X,STATUS_Y+i);
+			m_console->printStringOverwrite(lines[i].c_str());
+		}
+		m_console->gotoXY(PROMPT_X,PROMPT_Y);
+		string prompt = "(u)nasm,(g)o,(s)ilent,(d)mp,(e)dt,(r)eg,(i)p,(w)atch,(b)rk,bac(k),(q)uit,##: ";
+		m_console->printStringOverwrite(prompt);
+		m_console->gotoXY(PROMPT_X+prompt.size(),PROMPT_Y);
+		string result = m_console->getString();
+
+		if (result.length() == 0)
+		{
+			// user hit enter
+
+			return;
+		}
+		
+		switch (toupper(result[0]))
+		{
+			case 'U':
+				if (result.length() == 1)
+					printDisassembly(m_ip);
+				else
+					printDisassembly((uint16)atoi(result.c_str() + 1));
+				m_world->redrawAll();
+				break;
+			case 'G':
+			case 'S':
+				if (result.length() == 1)
+					m_goUntilIP = GO_INDEFINITELY_IP;
+				else
+					m_goUntilIP = (uint16)atoi(result.c_str()+1);
+
+				if (toupper(result[0]) == 'S')
+					m_world->setQuiet(true);
+
+				// adjust to valid IP
+				while (m_goUntilIP % INSTR_SLOTS)
+					m_goUntilIP = (m_goUntilIP + 1) % MAX_DNA;
+				return;
+
+			case 'D':
+				if (result.length() == 1)
+					printData(m_ip);
+				else				
+					printData((uint16)atoi(result.c_str()+1));
+				m_world->redrawAll();
+				break;
+			case 'E':
+				editData(result);
+				break;
+			case 'I':
+				m_ip = (uint16)atoi(result.c_str()+1);
+				validateIP();
+				break;
+			case 'R':
+				editRegister(result);
+				break;
+			case 'W':
+			case 'B':
+				editWatches(result);
+				break;
+			case 'K':
+				stepBack(result);
+				if (m_stopAtTick != INVALID_TICK)
+					return;
+				break;
+			case 'Q':
+				m_world->terminate();
+				return;
+			default:
+				if (isdigit(result[0]))
+				{
+					m_traceCount = atoi(result.c_str());
+					return;
+				}
+				break;
+		}
+
+		getDisplayLines(lines);
+	}
+}
+
+// k      step back one tick
+// k##    step back ## ticks
+// k@##   run back to the last tick at which the IP was ##
+// the world rewinds to the nearest checkpoint and replays silently from it
+
+void Organism::stepBack(const std::string &data)
+{
+	uint32 tick = m_world->getTickNum(), target;
+	char temp[256];
+
+	temp[0] = 0;
+
+	if (data.length() > 1 && data[1] == '@')
+	{
+		uint16 ip = (uint16)atoi(data.c_str()+2);
+		uint32 i = tick - m_historyStart;
+
+		while (i > 0 && m_ipHistory[i-1] != ip)
+			--i;
+		if (i == 0)
+		{
+			sprintf(temp,"IP %d was not reached since tick %u",ip,m_historyStart);
+			target = INVALID_TICK;
+		}
+		else
+			target = m_historyStart + i - 1;
+	}
+	else
+	{
+		uint32 n = (data.length() > 1) ? (uint32)atoi(data.c_str()+1) : 1;
+		target = (n < tick) ? tick - n : 0;
+	}
+
+	if (target != INVALID_TICK)
+	{
+		if (m_world->rewind(target) == true)
+		{
+			m_stopAtTick = target;
+			m_goUntilIP = INVALID_IP;
+			m_traceCount = 0;
+			m_world->setQuiet(true);
+		}
+		else
+			sprintf(temp,"no checkpoint at or before tick %u",target);
+	}
+
+	m_console->gotoXY(STATUS_X,WATCH_Y);
+	m_console->printStringOverwrite(temp);
+}
+
+void Organism::getState(OrganismState &state)
+{
+	sync();
+	memcpy(state.dna,m_dna,sizeof(m_dna));
+	memcpy(state.regs,m_regs,sizeof(m_regs));
+	state.ip = m_ip;
+	state.x = m_x;
+	state.y = m_y;
+	state.poked = m_poked;
+	state.energy = m_energy;
+	state.ledger = m_ledger;
+}
+
+void Organism::setState(const OrganismState &state)
+{
+	memcpy(m_dna,state.dna,sizeof(m_dna));
+	memcpy(m_regs,state.regs,sizeof(m_regs));
+	m_ip = state.ip;
+	m_x = state.x;
+	m_y = state.y;
+	m_poked = state.poked != 0;
+	m_energy = state.energy;
+	m_ledger = state.ledger;
+	if (m_hashing)
+		rehashDNA();
+	m_asleep = false;
+	resetProbe();
+}
+
+void Organism::setHashing(bool hashing)
+{
+	m_hashing = hashing;
+	if (m_hashing)
+		rehashDNA();
+}
+
+void Organism::rehashDNA(void)
+{
+	m_dnaHash = 0;
+	for (uint32 i=0;i<MAX_DNA;i++)
+		m_dnaHash ^= hashKey(i,m_dna[i]);
+}
+
+// everything in OrganismState except the ledger, which only observes;
+// without the energy, just whether it is alive (--cycles)
+
+uint64 Organism::hashState(bool withEnergy)
+{
+	sync();
+
+	uint64 h = m_dnaHash, word;
+
+	for (uint32 i=0;i<MAX_REGS;i+=4)
+	{
+		memcpy(&word,m_regs+i,sizeof(word));
+		h = hashWord(h,word);
+	}
+	h = hashWord(h,((uint64)m_ip << 48) | ((uint64)m_x << 32) | ((uint64)m_y << 16) | m_poked);
+	return(hashMix(h,withEnergy ? (uint32)m_energy : (uint32)alive()));
+}
+
+void Organism::watchEnergy(bool watch)
+{
+	m_watchEnergy = watch;
+	m_energyRead = false;
+	m_energyLow = -MAX_ORGANISM_ENERGY;
+	m_energyHigh = MAX_ORGANISM_ENERGY;
+}
+
+bool Organism::getEnergyWindow(sint32 &low, sint32 &high)
+{
+	low = m_energyLow;
+	high = m_energyHigh;
+	return(m_energyRead == false);
+}
+
+// the state repeated since before but for the energy: go on periods more
+// repeats, which (within the energy window) only move the energy and the
+// ledger along
+
+void Organism::repeatPeriods(const OrganismState &before, uint32 periods)
+{
+	wake();
+	m_energy -= (sint32)periods * (before.energy - m_energy);
+	repeatLedger(m_ledger,before.ledger,periods);
+}
+
+// ENGINE_SLEEP.  An instruction is quiet if all it can change is the
+// registers and the IP, and all it reads besides is its own DNA; while an
+// organism runs nothing else, only a neighbour's poke can change what it
+// does next.  (A peek only reads the DNA, which quiet code leaves alone, so
+// it needs no wake-up.)
+
+bool Organism::isQuiet(void)
+{
+	uint16 opcode = m_dna[m_ip];
+
+	switch (opcode & OPCODE_MASK)
+	{
+		case OPCODE_NOP:
+		case OPCODE_JMP:
+		case OPCODE_JL:
+		case OPCODE_JLE:
+		case OPCODE_JG:
+		case OPCODE_JGE:
+		case OPCODE_JE:
+		case OPCODE_JNE:
+		case OPCODE_JS:
+		case OPCODE_JNS:
+		case OPCODE_RET:
+		case OPCODE_CMP:
+		case OPCODE_TEST:
+			return(true);
+		case OPCODE_MOV:
+		case OPCODE_POP:
+		case OPCODE_ADD:
+		case OPCODE_SUB:
+		case OPCODE_MULT:
+		case OPCODE_DIV:
+		case OPCODE_MOD:
+		case OPCODE_AND:
+		case OPCODE_OR:
+		case OPCODE_XOR:
+		case OPCODE_SHL:
+		case OPCODE_SHR:
+		case OPCODE_CKSUM:
+			return(((opcode >> 14) & 0x3) == ADDR_MODE_REG);
+		case OPCODE_GETXY:
+			return(((opcode >> 14) & 0x3) == ADDR_MODE_REG && ((opcode >> 12) & 0x3) == ADDR_MODE_REG);
+		default:
+			return(false);
+	}
+}
+
+// run ahead while every instruction is quiet; if the registers and the IP
+// come back to where they started, that is a loop the organism can't leave
+// on its own.  Either way it is put back as it was.  The loop's length, or 0
+
+uint32 Organism::findIdleLoop(void)
+{
+	uint16 regs[MAX_REGS];
+	uint32 period = 0;
+
+	validateIP();
+	memcpy(regs,m_regs,sizeof(m_regs));
+	uint16 ip = m_ip;
+	sint32 energy = m_energy;
+
+	for (uint32 n=1;n<=SLEEP_PROBE_STEPS;n++)
+	{
+		validateIP();
+		if (isQuiet() == false)
+			break;
+		execInstr();
+		if (m_ip == ip && memcmp(m_regs,regs,sizeof(m_regs)) == 0)
+		{
+			period = n;
+			break;
+		}
+	}
+
+	memcpy(m_regs,regs,sizeof(m_regs));
+	m_ip = ip;
+	m_energy = energy;
+	return(period);
+}
+
+// this tick's instruction is the first one slept through if we go to sleep.
+// Only organisms that have spent nothing but compute since the last look
+// are probed, and each probe that finds no loop puts the next one off longer
+
+bool Organism::probeIdleLoop(uint32 tick)
+{
+	bool idle = m_probeEnergy - m_energy == (sint32)(tick - m_probeTick);
+	uint32 period = 0;
+
+	if (idle && m_debugHooks == false && m_energy > SLEEP_PROBE_STEPS)
+		period = findIdleLoop();
+	m_probeTick = tick;
+	m_probeEnergy = m_energy;
+	if (period == 0)
+	{
+		if (idle)
+			m_probeInterval = std::min(m_probeInterval * 2,(uint32)MAX_SLEEP_PROBE_INTERVAL);
+		m_nextProbe = tick + m_probeInterval;
+		return(false);
+	}
+
+	m_asleep = true;
+	m_sleepTick = tick;
+	m_sleepEnergy = m_energy;
+	m_sleepPeriod = period;
+	m_probeInterval = SLEEP_PROBE_INTERVAL;
+	return(true);
+}
+
+// catch up on the instructions slept through: the loop's registers and IP
+// are wherever the part period left over puts them, and the energy is down
+// by one per instruction.  The sleep goes on from here
+
+void Organism::sync(void)
+{
+	if (m_asleep == false)
+		return;
+
+	uint32 ran = m_world->getTicksSince(m_sleepTick,m_organismID);
+	for (uint32 i=ran % m_sleepPeriod;i>0;i--)
+		execInstr();
+	m_energy = m_sleepEnergy - (sint32)ran;
+	m_sleepTick += ran;
+	m_sleepEnergy = m_energy;
+}
+
+void Organism::wake(void)
+{
+	if (m_asleep == false)
+		return;
+
+	sync();
+	m_asleep = false;
+	resetProbe();
+}
+
+void Organism::resetProbe(void)
+{
+	m_probeTick = m_world->getTickNum();
+	m_probeEnergy = m_energy;
+	m_probeInterval = SLEEP_PROBE_INTERVAL;
+	m_nextProbe = m_probeTick + m_probeInterval;
+}
+
+void Organism::editData(const std::string &data)
+{
+	unsigned int off, val;
+
+	if (sscanf(data.c_str() + 1, "%u %u", &off, &val) && off < MAX_DNA)
+		m_dna[(uint16)off] = (uint16)val;
+}
+
+// w            list watchpoints and breakpoints
+// w 100[-120]  stop when DNA slot 100 (to 120) changes
+// w r3|sp|flags  stop when the register changes
+// w poke       stop when a neighbour pokes our DNA
+// b expr       stop when expr becomes true, e.g. b r3 > 100 && flags&s
+// w- or b-     clear everything
+
+void Organism::editWatches(const std::string &data)
+{
+	string arg = data.substr(1);
+	string error;
+	char temp[256];
+
+	size_t start = arg.find_first_not_of(" \t");
+	arg = (start == string::npos) ? "" : arg.substr(start);
+
+	if (m_watches == NULL)
+		m_watches = new Watchpoints;
+
+	if (arg == "-")
+		m_watches->clear();
+	else if (toupper(data[0]) == 'B')
+	{
+		WatchState st;
+		getWatchState(st);
+		if (arg.length() == 0)
+			error = "usage: b expression";
+		else
+			m_watches->addBreak(arg,st,error);
+	}
+	else if (arg.length() == 0)
+	{
+		vector<string> v;
+		m_watches->getList(v);
+		unsigned int i;
+		for (i = 0; i < v.size() && i < UNASSEMBLE_LINES; i++)
+		{
+			m_console->gotoXY(STATUS_X, i + START_Y);
+			m_console->printStringOverwrite(v[i]);
+		}
+		for (; i < UNASSEMBLE_LINES; i++)
+		{
+			m_console->gotoXY(STATUS_X, i + START_Y);
+			m_console->printStringOverwrite("");
+		}
+		m_world->redrawAll();
+	}
+	else if (arg == "poke")
+		m_watches->watchPokes();
+	else if (arg == "sp")
+		m_watches->watchRegister(SP_REG,m_regs[SP_REG]);
+	else if (arg == "flags")
+		m_watches->watchRegister(FLAGS_REG,m_regs[FLAGS_REG]);
+	else if (toupper(arg[0]) == 'R')
+	{
+		unsigned int reg;
+		if (sscanf(arg.c_str()+1,"%u",&reg) == 1 && reg < FLAGS_REG)
+			m_watches->watchRegister((uint16)reg,m_regs[reg]);
+		else
+			error = "unknown register " + arg;
+	}
+	else
+	{
+		unsigned int first, last;
+		int n = sscanf(arg.c_str(),"%u-%u",&first,&last);
+		if (n == 1)
+			last = first;
+		if (n < 1 || first > last || last >= MAX_DNA)
+		{
+			sprintf(temp,"bad DNA slot(s); expected 0-%d",MAX_DNA-1);
+			error = temp;
+		}
+		else
+			m_watches->watchDNA((uint16)first,(uint16)last);
+	}
+
+	m_console->gotoXY(STATUS_X,WATCH_Y);
+	m_console->printStringOverwrite(error);
+}
+
+void Organism::editRegister(const std::string &data)
+{
+	unsigned int off, val;
+
+	if (sscanf(data.c_str() + 1, "%u %u", &off, &val) && off < MAX_REGS)
+		m_regs[(uint16)off] = (uint16)val;
+}
+
+void Organism::printDisassembly(uint16 start)
+{
+	std::vector<std::string> v;
+	m_disasm->getDisassembly(v, start, start + UNASSEMBLE_LINES * INSTR_SLOTS);
+
+	unsigned int i;
+	for (i = 0; i < v.size(); i++)
+	{
+		m_console->gotoXY(STATUS_X, i + START_Y);
+		m_console->printStringOverwrite(v[i]);
+	}
+	for (; i < UNASSEMBLE_LINES; i++)
+	{
+		m_console->gotoXY(STATUS_X, i + START_Y);
+		m_console->printStringOverwrite("");
+	}
+}
+
+void Organism::printData(uint16 start)
+{
+	uint16 lineNum = 0;
+
+	for (uint16 i=start; lineNum < DATA_LINES && i < MAX_DNA; i++)
+	{
+		char temp[256];
+
+		m_console->gotoXY(STATUS_X,lineNum + START_Y);
+		sprintf(temp,"%04d: %5d (%04X)",i,m_dna[i],m_dna[i]);
+		m_console->printStringOverwrite(temp);
+		lineNum++;
+	}
+	for (; lineNum < DATA_LINES; lineNum++) {
+		m_console->gotoXY(STATUS_X, lineNum + START_Y);
+		m_console->printStringOverwrite("");
+	}
+}
+
+
+bool Organism::setXY(uint16 x, uint16 y)
+{
+	if (x <= GRID_WIDTH && y <= GRID_HEIGHT)
+	{
+		m_x = x;
+		m_y = y;
+		return(true);
+	}
+	return(false);
+}
@@ -1,195 +1,337 @@
-//----------------------------------------------------------------------------
-//
-// organism.h
-//
-//----------------------------------------------------------------------------
-//
-// Copyright (c) 2006, Symantec Corporation All rights reserved.
-//
-// Redistribution and use in source and binary forms, with or without
-// modification, are permitted provided that the following conditions are
-// met:
-//
-// -  Redistributions of source code must retain the above copyright notice,
-// this list of conditions and the following disclaimer. 
-//
-// -  Redistributions in binary form must reproduce the above copyright
-// notice, this list of conditions and the following disclaimer in the
-// documentation and/or other materials provided with the distribution. 
-//
-// - Neither the name of Symantec Corp. nor the names of its contributors
-// may be used to endorse or promote products derived from this software
-// without specific prior written permission. 
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
-// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
-// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
-// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-//
-
-#ifndef _ORGANISM_H_
-
-#define _ORGANISM_H_
-
-#include "types.h"
-#include "constants.h"
-#include "mycon.h"
-#include "disasm.h"
-
-#include <stdio.h>
-
-class World;
-
-class Organism
-{
-public:
-	Organism
-	(
-		World *world, 
-		uint16  *myDNA, 
-		uint16 dnaSize,
-		uint32 startEnergy, 
-		uint16 organismID,
-		bool singleStep,
-		const std::string & moduleInfo, 
-		FILE *debugStream, 
-		bool noMutate,
-		CConsole *console
-	);
-	~Organism();
-	bool alive(void);
-	uint32 getEnergy(void);
-	bool getDNAValue(uint16 slot, uint16 &value);
-	bool setDNAValue(uint16 slot, uint16 value);
-	bool execInstr(void);		// true if still alive
-	void mutate(void);
-	void printDisassembly(uint16 start);
-	void printData(uint16 start);
-	bool setXY(uint16 x, uint16 y);
-	void editData(const std::string &data);
-	void editRegister(const std::string &data);
-	void getDisplayLines(std::vector<std::string> &lines);
-	void singleStep(std::vector<std::string> &lines);
-	std::string getModuleName(void)
-	{
-		return(m_moduleInfo);
-	}
-	uint16 getID(void)
-	{
-		return(m_organismID);
-	}
-	uint16 getX(void) { return(m_x); }
-	uint16 getY(void)	{ return(m_y); }
-	bool getOldXY(uint16 *x,uint16 *y) 
-	{ 
-		bool changed = m_x != m_oldX || m_y != m_oldY;
-
-		*x = m_oldX;
-		*y = m_oldY;
-
-		m_oldX = m_x;
-		m_oldY = m_y;
-
-		return(changed); 
-	}
-
-	char getDisplayChar(void)
-	{
-		if (m_energy <= 0)
-		{
-			if (m_botName == DRONE_STRING)
-				return(',');
-			else
-				return('.');
-		}
-		else
-		{
-			if (m_botName == DRONE_STRING)
-				return('@');
-			if (m_organismID < 26)
-				return((char)('A'+m_organismID));
-			else
-				return((char)('a'+m_organismID-26));
-		}
-	}
-
-private:
-
-	void travel(void);
-	void eat(void);
-	void sense(void);		// sense food on current square; id put in operand1
-	bool newXY(uint16 dir, uint16 *newX, uint16 *newY);
-	uint32 oppositeDir(uint32 dir);
-	void setValue(uint16 opcode, uint16 opNum, uint16 opValue, uint16 value);
-	uint16 getValue(uint16 opcode, uint16 opNum, uint16 opValue);
-	void mov(void);
-	void add(void);
-	void sub(void);
-	void mult(void);
-	void div(void);
-	void mod(void);
-	void andOp(void);
-	void orOp(void);
-	void xorOp(void);
-	void shl(void);
-	void shr(void);
-	void test(void);
-	void cmp(void);
-	void jmp(bool &updateIP);
-	void je(bool &updateIP);
-	void jne(bool &updateIP);
-	void jl(bool &updateIP);
-	void jle(bool &updateIP);
-	void jg(bool &updateIP);
-	void jge(bool &updateIP);
-	void js(bool &updateIP);
-	void jns(bool &updateIP);
-	void randNum(void);
-	void internalPush(uint16 value);
-	uint16 internalPop();
-	void call(bool &updateIP);
-	void ret(bool &updateIP);
-	void nop(void);
-	void getxy(void);
-	void energy(void);
-	void validateIP(void);
-	void poke(void);
-	void peek(void);
-	void push(void);
-	void pop(void);
-	void release(void);
-	void charge(void);
-	void cksum(void);
-	bool increaseEnergy(uint16 energyAmt);
-	void debug(void);
-
-private:
-	World	*m_world;
-	uint16	m_dna[MAX_DNA];
-	uint16	m_regs[MAX_REGS];
-	uint16	m_ip;	
-	sint32	m_energy;
-	uint16	m_organismID;
-	uint16	m_x, m_y;
-	bool	m_noMutate;
-	std::string m_moduleInfo;
-	std::string m_botName;
-	FILE		*m_debugStream;
-	bool		m_singleStep;
-	CConsole	*m_console;
-	uint16		m_goUntilIP;
-	uint16		m_oldX;
-	uint16		m_oldY;
-	uint32		m_traceCount;
-	DisAsm		*m_disasm;
-};
-
-
-#endif // #ifndef _ORGANISM_H_
+//----------------------------------------------------------------------------
+//
+// organism.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer. 
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution. 
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission. 
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef _ORGANISM_H_
+
+#define _ORGANISM_H_
+
+#include "types.h"
+#include "constants.h"
+#include "mycon.h"
+#include "disasm.h"
+#include "watch.h"
+#include "trace.h"
+#include "profile.h"
+#include "ledger.h"
+#include "statehash.h"
+
+#include <stdio.h>
+#include <algorithm>
+
+class World;
+
+// everything about an organism that affects the simulation (see World
+// checkpoints); display and debugger state are left out
+
+struct OrganismState
+{
+	uint16	dna[MAX_DNA];
+	uint16	regs[MAX_REGS];
+	uint16	ip;
+	uint16	x, y;
+	uint16	poked;
+	sint32	energy;
+	EnergyLedger ledger;
+};
+
+class Organism
+{
+public:
+	Organism
+	(
+		World *world, 
+		uint16  *myDNA, 
+		uint16 dnaSize,
+		uint32 startEnergy, 
+		uint16 organismID,
+		bool singleStep,
+		const std::string & moduleInfo, 
+		TraceWriter *trace, 
+		bool noMutate,
+		CConsole *console
+	);
+	~Organism();
+	bool alive(void);
+	uint32 getEnergy(void);
+	bool getDNAValue(uint16 slot, uint16 &value);
+	bool setDNAValue(uint16 slot, uint16 value);
+	bool execInstr(void);		// true if still alive
+	void mutate(void);
+	void printDisassembly(uint16 start);
+	void printData(uint16 start);
+	bool setXY(uint16 x, uint16 y);
+	void editData(const std::string &data);
+	void editRegister(const std::string &data);
+	void getDisplayLines(std::vector<std::string> &lines);
+	static void formatDisplayLines
+	(
+		std::vector<std::string> &lines,
+		const std::string &botName,
+		uint16 organismID,
+		uint16 x,
+		uint16 y,
+		sint32 energy,
+		uint16 ip,
+		uint16 *regs,
+		DisAsm &disasm
+	);
+	void singleStep(std::vector<std::string> &lines);
+	void editWatches(const std::string &data);
+	void getState(OrganismState &state);
+	void setState(const OrganismState &state);
+	std::string getModuleName(void)
+	{
+		return(m_moduleInfo);
+	}
+	uint16 getID(void)
+	{
+		return(m_organismID);
+	}
+	void setSingleStep(bool singleStep)
+	{
+		m_singleStep = singleStep;
+		m_debugHooks = m_singleStep || m_trace != NULL || m_profile != NULL;
+		if (m_debugHooks)
+			wake();			// hooks see every instruction from here on
+	}
+	ExecProfile *getProfile(void)
+	{
+		return(m_profile);
+	}
+	void setProfile(ExecProfile *profile)
+	{
+		m_profile = profile;
+		m_debugHooks = m_singleStep || m_trace != NULL || m_profile != NULL;
+		if (m_debugHooks)
+			wake();
+	}
+	bool wasPoked(void)
+	{
+		return(m_poked);
+	}
+	uint16 getIP(void)
+	{
+		return(m_ip);
+	}
+	void setHashing(bool hashing);
+	uint64 hashState(bool withEnergy = true);
+
+	// --cycles: while watched, the range of uniform shifts [low,high] to this
+	// organism's energy over which every outcome that depended on it would
+	// have come out the same; false if the energy was read into the state
+	void watchEnergy(bool watch);
+	void noteEnergy(void)
+	{
+		sync();
+		energyAtLeast(1,m_energy >= 1);		// still alive
+	}
+	bool getEnergyWindow(sint32 &low, sint32 &high);
+	void repeatPeriods(const OrganismState &before, uint32 periods);
+
+	// ENGINE_SLEEP: an organism whose registers and IP come back round
+	// without it touching anything else sleeps; its state is brought up to
+	// date (sync) whenever anyone looks at it, and it wakes when a neighbour
+	// writes to it or at its wake tick, to run its last instruction itself
+	bool trySleep(uint32 tick)
+	{
+		if (tick < m_nextProbe)
+			return(false);
+		return(probeIdleLoop(tick));
+	}
+	bool isAsleep(void)
+	{
+		return(m_asleep);
+	}
+	uint32 getWakeTick(void)
+	{
+		return(m_sleepTick + m_sleepEnergy - 1);
+	}
+	void sync(void);
+	void wake(void);
+	const EnergyLedger &getLedger(void)
+	{
+		return(m_ledger);
+	}
+	sint32 getSignedEnergy(void)
+	{
+		return(m_energy);
+	}
+	void onPoisoned(void)
+	{
+		m_ledger.poisonMutations++;
+		mutate();
+	}
+	uint16 getX(void) { return(m_x); }
+	uint16 getY(void)	{ return(m_y); }
+
+	char getDisplayChar(void)
+	{
+		if (m_energy <= 0)
+		{
+			if (m_botName == DRONE_STRING)
+				return(',');
+			else
+				return('.');
+		}
+		else
+		{
+			if (m_botName == DRONE_STRING)
+				return('@');
+			if (m_organismID < 26)
+				return((char)('A'+m_organismID));
+			else
+				return((char)('a'+m_organismID-26));
+		}
+	}
+
+private:
+
+	void travel(void);
+	void eat(void);
+	void sense(void);		// sense food on current square; id put in operand1
+	bool newXY(uint16 dir, uint16 *newX, uint16 *newY);
+	uint32 oppositeDir(uint32 dir);
+	void setValue(uint16 opcode, uint16 opNum, uint16 opValue, uint16 value);
+	uint16 getValue(uint16 opcode, uint16 opNum, uint16 opValue);
+	void mov(void);
+	void add(void);
+	void sub(void);
+	void mult(void);
+	void div(void);
+	void mod(void);
+	void andOp(void);
+	void orOp(void);
+	void xorOp(void);
+	void shl(void);
+	void shr(void);
+	void test(void);
+	void cmp(void);
+	void jmp(bool &updateIP);
+	void je(bool &updateIP);
+	void jne(bool &updateIP);
+	void jl(bool &updateIP);
+	void jle(bool &updateIP);
+	void jg(bool &updateIP);
+	void jge(bool &updateIP);
+	void js(bool &updateIP);
+	void jns(bool &updateIP);
+	void randNum(void);
+	void internalPush(uint16 value);
+	uint16 internalPop();
+	void call(bool &updateIP);
+	void ret(bool &updateIP);
+	void nop(void);
+	void getxy(void);
+	void energy(void);
+	void validateIP(void);
+	void poke(void);
+	void peek(void);
+	void push(void);
+	void pop(void);
+	void release(void);
+	void charge(void);
+	void cksum(void);
+	bool increaseEnergy(uint16 energyAmt);
+	void debug(void);
+	bool debuggerShouldStop(void);
+	void stepBack(const std::string &data);
+	void getWatchState(WatchState &st);
+	void rehashDNA(void);
+	bool isQuiet(void);
+	bool probeIdleLoop(uint32 tick);
+	uint32 findIdleLoop(void);
+	void resetProbe(void);
+	void energyAtLeast(sint32 value, bool held)
+	{
+		if (m_watchEnergy == false)
+			return;
+		if (held)
+			m_energyLow = std::max(m_energyLow,value - m_energy);
+		else
+			m_energyHigh = std::min(m_energyHigh,value - m_energy - 1);
+	}
+	void storeDNA(uint16 slot, uint16 value, bool poked = false)
+	{
+		if (m_watches != NULL)
+			m_watches->onWrite(slot,m_dna[slot],value,poked);
+		if (m_hashing)
+			m_dnaHash ^= hashKey(slot,m_dna[slot]) ^ hashKey(slot,value);
+		m_dna[slot] = value;
+	}
+
+private:
+	World	*m_world;
+	uint16	m_dna[MAX_DNA];
+	uint16	m_regs[MAX_REGS];
+	uint16	m_ip;	
+	sint32	m_energy;
+	uint16	m_organismID;
+	uint16	m_x, m_y;
+	bool	m_noMutate;
+	std::string m_moduleInfo;
+	std::string m_botName;
+	TraceWriter	*m_trace;			// -l; owned by the world
+	ExecProfile	*m_profile;			// --profile; owned by the caller
+	bool		m_singleStep;
+	CConsole	*m_console;
+	uint16		m_goUntilIP;
+	uint32		m_traceCount;
+	DisAsm		*m_disasm;
+	uint32		m_stopAtTick;		// replaying forward after a rewind
+	std::vector<uint16> m_ipHistory;	// debugger only: IP at each tick...
+	uint32		m_historyStart;		// ...starting with this one
+	bool		m_debugHooks;		// any of single-step/trace active
+	bool		m_poked;			// set once another organism pokes our DNA
+	Watchpoints	*m_watches;			// debugger stop conditions; NULL until one is set
+	EnergyLedger m_ledger;			// --ledger
+	bool		m_hashing;			// --verify: keep m_dnaHash current
+	uint64		m_dnaHash;
+	bool		m_watchEnergy;		// --cycles: confirming a repeat
+	bool		m_energyRead;		// energy opcode while watched
+	sint32		m_energyLow;		// energy window while watched
+	sint32		m_energyHigh;
+	bool		m_asleep;			// ENGINE_SLEEP: looping since...
+	uint32		m_sleepTick;		// ...this tick, from the current state...
+	sint32		m_sleepEnergy;		// ...and energy...
+	uint32		m_sleepPeriod;		// ...every this many instructions
+	uint32		m_nextProbe;		// look for an idle loop then...
+	uint32		m_probeInterval;
+	uint32		m_probeTick;		// ...if only compute was spent since
+	sint32		m_probeEnergy;
+};
+
+
+#endif // #ifndef _ORGANISM_H_
@@ -0,0 +1,211 @@
+//----------------------------------------------------------------------------
+//
+// perfcount.cpp
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include "perfcount.h"
+
+#include <cstring>
+#include <cerrno>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif // #ifdef __linux__
+
+static const char *g_perfNames[NUM_PERF_COUNTERS] =
+{
+	"cycles",
+	"host instructions",
+	"branch misses",
+	"L1D read misses",
+	"LLC read misses"
+};
+
+PerfCounters::PerfCounters()
+{
+	for (int i=0;i<NUM_PERF_COUNTERS;i++)
+	{
+		m_fd[i] = -1;
+		m_value[i] = 0;
+	}
+	m_scaled = false;
+}
+
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+	for (int i=0;i<NUM_PERF_COUNTERS;i++)
+		if (m_fd[i] >= 0)
+			close(m_fd[i]);
+#endif // #ifdef __linux__
+}
+
+#ifdef __linux__
+
+static uint64 cacheConfig(uint64 cache)
+{
+	return(cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+}
+
+bool PerfCounters::open(std::string &error)
+{
+	static const uint32 types[NUM_PERF_COUNTERS] =
+	{
+		PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+		PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE
+	};
+	const uint64 configs[NUM_PERF_COUNTERS] =
+	{
+		PERF_COUNT_HW_CPU_CYCLES,
+		PERF_COUNT_HW_INSTRUCTIONS,
+		PERF_COUNT_HW_BRANCH_MISSES,
+		cacheConfig(PERF_COUNT_HW_CACHE_L1D),
+		cacheConfig(PERF_COUNT_HW_CACHE_LL)
+	};
+
+	int opened = 0, lastErrno = 0;
+
+	for (int i=0;i<NUM_PERF_COUNTERS;i++)
+	{
+		struct perf_event_attr attr;
+
+		memset(&attr,0,sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = types[i];
+		attr.config = configs[i];
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;		// allowed at perf_event_paranoid 2
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+		m_fd[i] = (int)syscall(__NR_perf_event_open,&attr,0,-1,-1,0);
+		if (m_fd[i] >= 0)
+			opened++;
+		else
+			lastErrno = errno;
+	}
+
+	if (opened == 0)
+	{
+		error = std::string("hardware counters unavailable (") + strerror(lastErrno) + ")";
+		if (lastErrno == EACCES || lastErrno == EPERM)
+			error += "; see /proc/sys/kernel/perf_event_paranoid";
+		return(false);
+	}
+
+	return(true);
+}
+
+void PerfCounters::start(void)
+{
+	for (int i=0;i<NUM_PERF_COUNTERS;i++)
+		if (m_fd[i] >= 0)
+		{
+			ioctl(m_fd[i],PERF_EVENT_IOC_RESET,0);
+			ioctl(m_fd[i],PERF_EVENT_IOC_ENABLE,0);
+		}
+}
+
+void PerfCounters::stop(void)
+{
+	for (int i=0;i<NUM_PERF_COUNTERS;i++)
+		if (m_fd[i] >= 0)
+			ioctl(m_fd[i],PERF_EVENT_IOC_DISABLE,0);
+
+	for (int i=0;i<NUM_PERF_COUNTERS;i++)
+	{
+		uint64 v[3];		// value, time enabled, time running
+
+		if (m_fd[i] < 0)
+			continue;
+		if (read(m_fd[i],v,sizeof(v)) != sizeof(v) || v[2] == 0)
+		{
+			close(m_fd[i]);
+			m_fd[i] = -1;
+			continue;
+		}
+
+		m_value[i] = (double)v[0];
+		if (v[2] < v[1])
+		{
+			m_value[i] *= (double)v[1] / v[2];
+			m_scaled = true;
+		}
+	}
+}
+
+#else
+
+bool PerfCounters::open(std::string &error)
+{
+	error = "hardware counters are only supported on Linux";
+	return(false);
+}
+
+void PerfCounters::start(void)
+{
+}
+
+void PerfCounters::stop(void)
+{
+}
+
+#endif // #ifdef __linux__
+
+void PerfCounters::print(FILE *stream, uint64 instructions, uint32 ticks)
+{
+	fprintf(stream,"Hardware counters over %llu simulated instructions, %u ticks%s:\n",
+		(unsigned long long)instructions,ticks,m_scaled ? " (some multiplexed and scaled)" : "");
+	fprintf(stream,"%-18s %16s %14s %14s\n","counter","total","per instr","per tick");
+
+	for (int i=0;i<NUM_PERF_COUNTERS;i++)
+	{
+		if (m_fd[i] < 0)
+		{
+			fprintf(stream,"%-18s %16s\n",g_perfNames[i],"unavailable");
+			continue;
+		}
+		fprintf(stream,"%-18s %16.0f %14.3f %14.1f\n",
+			g_perfNames[i],
+			m_value[i],
+			instructions > 0 ? m_value[i] / instructions : 0.0,
+			ticks > 0 ? m_value[i] / ticks : 0.0);
+	}
+
+	if (m_fd[PERF_CYCLES] >= 0 && m_fd[PERF_INSTRUCTIONS] >= 0 && m_value[PERF_CYCLES] > 0)
+		fprintf(stream,"IPC: %.2f\n",m_value[PERF_INSTRUCTIONS] / m_value[PERF_CYCLES]);
+}
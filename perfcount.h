@@ -0,0 +1,80 @@
+//----------------------------------------------------------------------------
+//
+// perfcount.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef _PERFCOUNT_H_
+
+#define _PERFCOUNT_H_
+
+#include <stdio.h>
+#include <string>
+
+#include "types.h"
+
+// --perf: hardware counters around World::run, from Linux perf_event_open.
+// Each counter is opened on its own so one the CPU (or a container) refuses
+// does not take the others with it; counters the kernel multiplexes are
+// scaled by the fraction of the run they were live.  Elsewhere open() fails
+// and the run goes ahead without them.
+
+enum
+{
+	PERF_CYCLES,
+	PERF_INSTRUCTIONS,
+	PERF_BRANCH_MISSES,
+	PERF_L1D_MISSES,
+	PERF_LLC_MISSES,
+	NUM_PERF_COUNTERS
+};
+
+class PerfCounters
+{
+public:
+	PerfCounters();
+	~PerfCounters();
+
+	bool open(std::string &error);		// true if any counter is available
+	void start(void);
+	void stop(void);
+	void print(FILE *stream, uint64 instructions, uint32 ticks);
+
+private:
+	int		m_fd[NUM_PERF_COUNTERS];	// -1 if unavailable
+	double	m_value[NUM_PERF_COUNTERS];
+	bool	m_scaled;					// some counter was multiplexed
+};
+
+
+#endif // #ifndef _PERFCOUNT_H_
@@ -0,0 +1,108 @@
+//----------------------------------------------------------------------------
+//
+// phase.cpp
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include "phase.h"
+
+#include <cstring>
+
+PhaseProfile::PhaseProfile()
+{
+	memset(m_calls,0,sizeof(m_calls));
+	memset(m_timed,0,sizeof(m_timed));
+	memset(m_ns,0,sizeof(m_ns));
+	memset(m_items,0,sizeof(m_items));
+
+	const int reads = 1024;
+	uint64 start = now();
+	for (int i=1;i<reads;i++)
+		now();
+	m_clockNs = (double)(now() - start) / reads;
+}
+
+// total time, less the clock reads, scaled up from the calls that were timed
+
+double PhaseProfile::getNs(int phase)
+{
+	if (m_timed[phase] == 0)
+		return(0);
+	double ns = (double)m_ns[phase] - m_timed[phase] * m_clockNs;
+	return((ns > 0 ? ns : 0) * m_calls[phase] / m_timed[phase]);
+}
+
+static void printPhase(FILE *stream, const char *name, uint64 calls, double ns, double runNs, const char *items, uint64 numItems)
+{
+	if (ns < 0)
+		ns = 0;
+	fprintf(stream,"%-14s %12llu %11.1f %6.1f%% %9.1f",
+		name,
+		(unsigned long long)calls,
+		ns / 1e6,
+		runNs > 0 ? ns * 100.0 / runNs : 0.0,
+		calls > 0 ? ns / calls : 0.0);
+	if (items != NULL && calls > 0)
+		fprintf(stream,"   %.2f %s",(double)numItems / calls,items);
+	fprintf(stream,"\n");
+}
+
+void PhaseProfile::print(FILE *stream, uint32 ticks)
+{
+	double run = getNs(PHASE_RUN);
+	double tick = getNs(PHASE_TICK);
+	double occupied = getNs(PHASE_OCCUPIED);
+	double food = getNs(PHASE_FOOD);
+	double debug = getNs(PHASE_DEBUG);
+	double display = getNs(PHASE_DISPLAY);
+
+	// two reads per timed call; the nested ones also land inside timed ticks
+	uint64 nested = m_timed[PHASE_OCCUPIED] + m_timed[PHASE_FOOD] + m_timed[PHASE_DEBUG];
+	double overhead = 2 * m_clockNs * (nested + m_timed[PHASE_TICK] + m_timed[PHASE_DISPLAY]);
+	double dispatch = tick - occupied - food - debug - 2 * m_clockNs * nested;
+
+	fprintf(stream,"Phase breakdown, %u ticks (frequent phases timed 1 call in %d):\n",ticks,PHASE_SAMPLE_RATE);
+	fprintf(stream,"%-14s %12s %11s %7s %9s\n","phase","calls","ms","run","ns/call");
+
+	// the nested phases all run inside World::tick
+	printPhase(stream,"dispatch",m_items[PHASE_TICK],dispatch,run,NULL,0);
+	printPhase(stream,"occupied",m_calls[PHASE_OCCUPIED],occupied,run,"organisms scanned",m_items[PHASE_OCCUPIED]);
+	printPhase(stream,"food respawn",m_calls[PHASE_FOOD],food,run,"cells tried",m_items[PHASE_FOOD]);
+	if (m_calls[PHASE_DEBUG] > 0)
+		printPhase(stream,"debug checks",m_calls[PHASE_DEBUG],debug,run,NULL,0);
+	printPhase(stream,"display",m_calls[PHASE_DISPLAY],display,run,NULL,0);
+	printPhase(stream,"other",m_calls[PHASE_TICK],run - tick - display - overhead + 2 * m_clockNs * nested,run,NULL,0);
+	fprintf(stream,"%-14s %12s %11.1f %6.1f%%   (%.1f ns per clock read)\n","timer overhead","",
+		overhead / 1e6,run > 0 ? overhead * 100.0 / run : 0.0,m_clockNs);
+	fprintf(stream,"%-14s %12s %11.1f\n","run","",run / 1e6);
+}
@@ -0,0 +1,116 @@
+//----------------------------------------------------------------------------
+//
+// phase.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef _PHASE_H_
+
+#define _PHASE_H_
+
+#include <stdio.h>
+#include <chrono>
+
+#include "types.h"
+
+// --phases: where the host's time goes during World::run.  Each phase keeps a
+// call count, total nanoseconds and a phase-specific item count (instructions
+// per tick, organisms scanned per occupancy lookup, cells tried per food
+// respawn).
+//
+// Reading the clock costs about as much as an occupancy scan, so the phases
+// that run every tick or more often count every call but time only one in
+// PHASE_SAMPLE_RATE and scale up.  The cost of the clock itself is measured
+// up front and taken out again; dispatch is what is left of the tick once the
+// nested phases are removed.
+
+#define PHASE_SAMPLE_RATE		16		// power of two
+
+enum
+{
+	PHASE_RUN,			// the whole World::run loop
+	PHASE_TICK,			// World::tick: one instruction per live organism
+	PHASE_OCCUPIED,		// World::occupied lookups (travel, peek, poke, charge)
+	PHASE_FOOD,			// eatFood respawning the eaten food elsewhere
+	PHASE_DEBUG,		// Organism::debug checks (trace, profile, debugger)
+	PHASE_DISPLAY,		// showDisplay from the run loop
+	NUM_PHASES
+};
+
+class PhaseProfile
+{
+public:
+	PhaseProfile();
+
+	static uint64 now(void)
+	{
+		return((uint64)std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+	// every call, timed
+	void add(int phase, uint64 start, uint64 items = 0)
+	{
+		m_calls[phase]++;
+		m_timed[phase]++;
+		m_ns[phase] += now() - start;
+		m_items[phase] += items;
+	}
+	// sampled phases: count the call, true when this one should be timed
+	bool sample(int phase)
+	{
+		return((m_calls[phase]++ & (PHASE_SAMPLE_RATE-1)) == 0);
+	}
+	void addSample(int phase, uint64 start)
+	{
+		m_timed[phase]++;
+		m_ns[phase] += now() - start;
+	}
+	void addItems(int phase, uint64 items)
+	{
+		m_items[phase] += items;
+	}
+	void print(FILE *stream, uint32 ticks);
+
+private:
+	double getNs(int phase);
+
+private:
+	uint64	m_calls[NUM_PHASES];
+	uint64	m_timed[NUM_PHASES];
+	uint64	m_ns[NUM_PHASES];
+	uint64	m_items[NUM_PHASES];
+	double	m_clockNs;			// one now()
+};
+
+
+#endif // #ifndef _PHASE_H_
@@ -0,0 +1,243 @@
+//----------------------------------------------------------------------------
+//
+// profile.cpp
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#endif // #ifdef WIN32
+
+#include "profile.h"
+#include "compiler.h"
+
+#include <stdio.h>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+ExecProfile::ExecProfile(bool callStacks)
+{
+	memset(m_hits,0,sizeof(m_hits));
+	memset(m_energy,0,sizeof(m_energy));
+	m_runs = 0;
+	m_callStacks = callStacks;
+
+	StackNode root;
+	root.parent = 0;
+	root.entry = START_IP;
+	root.depth = 0;
+	root.ticks = root.energy = 0;
+	m_nodes.push_back(root);
+}
+
+void ExecProfile::onCall(uint16 orgID, uint16 target)
+{
+	if (m_callStacks == false)
+		return;
+
+	getCurrent(orgID);
+	OrgStack &org = m_orgs[orgID];
+
+	if (org.overflow > 0 || m_nodes[org.node].depth == MAX_SHADOW_DEPTH)
+	{
+		org.overflow++;
+		return;
+	}
+
+	// where the organism will really start executing; see Organism::validateIP
+	if (target % INSTR_SLOTS != 0)
+		target = (uint16)((target / INSTR_SLOTS + 1) * INSTR_SLOTS);
+	if (target > MAX_DNA-INSTR_SLOTS)
+		target = START_IP;
+
+	uint64 key = ((uint64)org.node << 16) | target;
+	map<uint64,uint32>::iterator it = m_children.find(key);
+	if (it != m_children.end())
+	{
+		org.node = (*it).second;
+		return;
+	}
+
+	StackNode n;
+	n.parent = org.node;
+	n.entry = target;
+	n.depth = m_nodes[org.node].depth + 1;
+	n.ticks = n.energy = 0;
+	m_nodes.push_back(n);
+
+	org.node = (uint32)(m_nodes.size()-1);
+	m_children[key] = org.node;
+}
+
+// a ret with nothing called stays at the bottom: the organism has
+// unbalanced its stack and we cannot know what it meant
+void ExecProfile::onRet(uint16 orgID)
+{
+	if (m_callStacks == false)
+		return;
+
+	getCurrent(orgID);
+	OrgStack &org = m_orgs[orgID];
+
+	if (org.overflow > 0)
+		org.overflow--;
+	else
+		org.node = m_nodes[org.node].parent;
+}
+
+void ExecProfile::addRun(void)
+{
+	m_runs++;
+	m_orgs.clear();			// next run's organisms start at the bottom
+}
+
+bool ExecProfile::writeFolded(const std::string &file, bool byEnergy, OrganismBinary *ob, std::string &error)
+{
+	FILE *out = fopen(file.c_str(),"w");
+	if (out == NULL)
+	{
+		error = "unable to create " + file;
+		return(false);
+	}
+
+	// frame names: the label a frame was called at, else its IP
+	vector<string> names(m_nodes.size());
+	for (uint32 i=0;i<m_nodes.size();i++)
+	{
+		string name = ob->getLabel(m_nodes[i].entry);
+		if (name.length() == 0)
+		{
+			char temp[32];
+			sprintf(temp,"ip_%04d",m_nodes[i].entry);
+			name = temp;
+		}
+		names[i] = (i == 0) ? name : names[m_nodes[i].parent] + ";" + name;
+	}
+
+	for (uint32 i=0;i<m_nodes.size();i++)
+	{
+		uint64 weight = byEnergy ? m_nodes[i].energy : m_nodes[i].ticks;
+		if (weight > 0)
+			fprintf(out,"%s %llu\n",names[i].c_str(),(unsigned long long)weight);
+	}
+
+	fclose(out);
+	return(true);
+}
+
+// gcov style: "hits energy %energy | line: source".  Slots with no line
+// (padding, the zeroed tail of the DNA, code the organism wrote itself)
+// are summed in the header.
+
+bool ExecProfile::writeAnnotated(const std::string &file, OrganismBinary *ob, std::string &error)
+{
+	FILE *in = fopen(ob->getSourceFile().c_str(),"rt");
+	if (in == NULL)
+	{
+		error = "unable to read " + ob->getSourceFile();
+		return(false);
+	}
+
+	FILE *out = fopen(file.c_str(),"w");
+	if (out == NULL)
+	{
+		fclose(in);
+		error = "unable to create " + file;
+		return(false);
+	}
+
+	vector<uint64> lineHits, lineEnergy;
+	uint64 totalHits = 0, totalEnergy = 0, otherHits = 0, otherEnergy = 0;
+
+	for (uint16 i=0;i<MAX_DNA;i++)
+	{
+		uint32 line = ob->getSourceLine(i);
+
+		totalHits += m_hits[i];
+		totalEnergy += m_energy[i];
+		if (line == 0)
+		{
+			otherHits += m_hits[i];
+			otherEnergy += m_energy[i];
+			continue;
+		}
+		if (line >= lineHits.size())
+		{
+			lineHits.resize(line+1,0);
+			lineEnergy.resize(line+1,0);
+		}
+		lineHits[line] += m_hits[i];
+		lineEnergy[line] += m_energy[i];
+	}
+
+	fprintf(out,"// profile of %s over %u run(s)\n",ob->getSourceFile().c_str(),m_runs);
+	fprintf(out,"// %llu instructions, %llu energy; outside the source: %llu instructions, %llu energy\n",
+			(unsigned long long)totalHits,(unsigned long long)totalEnergy,
+			(unsigned long long)otherHits,(unsigned long long)otherEnergy);
+	fprintf(out,"//%14s %14s %7s\n","hits","energy","%energy");
+
+	char text[1024];
+	uint32 line = 0;
+
+	while (fgets(text,sizeof(text),in) != NULL)
+	{
+		++line;
+		if (line < lineHits.size() && (lineHits[line] > 0 || lineEnergy[line] > 0))
+			fprintf(out,"%16llu %14llu %6.2f%% |%5u: ",
+					(unsigned long long)lineHits[line],(unsigned long long)lineEnergy[line],
+					totalEnergy > 0 ? 100.0 * lineEnergy[line] / totalEnergy : 0.0,line);
+		else
+			fprintf(out,"%16s %14s %7s |%5u: ","-","-","",line);
+
+		// copy the line, however long, without its line ending
+		for (;;)
+		{
+			size_t len = strlen(text);
+			bool whole = len > 0 && text[len-1] == '\n';
+
+			while (len > 0 && (text[len-1] == '\n' || text[len-1] == '\r'))
+				text[--len] = 0;
+			fputs(text,out);
+			if (whole || fgets(text,sizeof(text),in) == NULL)
+				break;
+		}
+		fputs("\n",out);
+	}
+
+	fclose(in);
+	fclose(out);
+	return(true);
+}
@@ -0,0 +1,127 @@
+//----------------------------------------------------------------------------
+//
+// profile.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+#ifndef _PROFILE_H_
+
+#define _PROFILE_H_
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "types.h"
+#include "constants.h"
+
+class OrganismBinary;
+
+#define MAX_SHADOW_DEPTH	64		// deeper calls are charged to the frame at the limit
+
+// --profile: instructions executed and energy they cost, per DNA slot,
+// summed over every clone and every seed profiled.
+//
+// --flame also keeps a shadow call stack per organism from its call and ret
+// instructions.  Stacks are interned as a tree of (caller, callee entry)
+// nodes so each instruction only bumps the counters of its organism's
+// current node.
+
+class ExecProfile
+{
+public:
+	ExecProfile(bool callStacks);
+
+	void count(uint16 orgID, uint16 ip)
+	{
+		m_hits[ip]++;
+		m_energy[ip] += COMPUTE_ENERGY;
+		if (m_callStacks)
+		{
+			StackNode &n = m_nodes[getCurrent(orgID)];
+			n.ticks++;
+			n.energy += COMPUTE_ENERGY;
+		}
+	}
+	void addEnergy(uint16 orgID, uint16 ip, uint32 energy)
+	{
+		m_energy[ip] += energy;
+		if (m_callStacks)
+			m_nodes[getCurrent(orgID)].energy += energy;
+	}
+	void onCall(uint16 orgID, uint16 target);
+	void onRet(uint16 orgID);
+	void addRun(void);
+
+	// a copy of the source with hits and energy down the left
+	bool writeAnnotated(const std::string &file, OrganismBinary *ob, std::string &error);
+
+	// "caller;callee;... count" lines for flamegraph tools, weighted by
+	// ticks (instructions) or by energy
+	bool writeFolded(const std::string &file, bool byEnergy, OrganismBinary *ob, std::string &error);
+
+private:
+	struct StackNode
+	{
+		uint32	parent;
+		uint16	entry;			// IP the frame was called at
+		uint16	depth;
+		uint64	ticks, energy;
+	};
+
+	struct OrgStack
+	{
+		uint32	node;
+		uint32	overflow;		// calls past MAX_SHADOW_DEPTH not yet returned
+	};
+
+	uint32 getCurrent(uint16 orgID)
+	{
+		if (orgID >= m_orgs.size())
+			m_orgs.resize(orgID+1,OrgStack());
+		return(m_orgs[orgID].node);
+	}
+
+private:
+	uint64	m_hits[MAX_DNA];
+	uint64	m_energy[MAX_DNA];
+	uint32	m_runs;
+
+	bool						m_callStacks;
+	std::vector<StackNode>		m_nodes;		// 0 is START_IP
+	std::map<uint64,uint32>		m_children;		// parent << 16 | entry -> node
+	std::vector<OrgStack>		m_orgs;			// by organism ID
+};
+
+#endif // #ifndef _PROFILE_H_
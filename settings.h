@@ -1,326 +1,985 @@
-//----------------------------------------------------------------------------
-//
-// settings.h
-//
-//----------------------------------------------------------------------------
-//
-// Copyright (c) 2006, Symantec Corporation All rights reserved.
-//
-// Redistribution and use in source and binary forms, with or without
-// modification, are permitted provided that the following conditions are
-// met:
-//
-// -  Redistributions of source code must retain the above copyright notice,
-// this list of conditions and the following disclaimer. 
-//
-// -  Redistributions in binary form must reproduce the above copyright
-// notice, this list of conditions and the following disclaimer in the
-// documentation and/or other materials provided with the distribution. 
-//
-// - Neither the name of Symantec Corp. nor the names of its contributors
-// may be used to endorse or promote products derived from this software
-// without specific prior written permission. 
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
-// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
-// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
-// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-//
-
-#ifndef _SETTINGS_H_
-
-#define _SETTINGS_H_
-
-#include <stdio.h>
-#include <time.h>
-#include <stdlib.h>
-#include <string>
-#include <cstring>
-#include <cctype>
-
-#include "types.h"
-#include "constants.h"
-
-class Settings
-{
-public:
-	Settings()
-	{
-		m_maxIterations = DEFAULT_MAX_ITERATIONS;
-		m_maxOrganisms = DEFAULT_MAX_ORGANISMS;
-		m_maxDrones = DEFAULT_MAX_DRONES;
-		m_foodDensity = DEFAULT_FOOD_DENSITY;
-		m_singleStepID = INVALID_ID;
-		m_singleStep = false;
-		m_seed = (uint32)time(NULL);
-		m_quiet = false;
-	}
-	
-	bool LoadSettings(int argc, char *argv[], std::string &error)
-	{
-		FILE *stream;
-
-		if (argc == 1)
-		{
-			printf("\nSymantec 2006 University Programming Competition\n"); 
-			printf("(C)Copyright 2006, Symantec Corporation\n");
-//			printf("by Carey Nachenberg\n");
-			printf("\nusage: contest06 -option1:value1 -option2:value2 ...\n\n");
-//			printf(" -d:drone.asm  *Specify the drone's DNA\n");
-//			printf(" -f:##         Specify food density percentage (default=%d%%)\n",DEFAULT_FOOD_DENSITY);
-			printf(" -g:X          Single-step debug the organism specified by X (a letter)\n");
-			printf(" -i:####       Specify # of iterations (default=%d)\n",DEFAULT_MAX_ITERATIONS);
-			printf(" -l:log.txt    Log organism program trace to log.txt\n");
-//			printf(" -n:####       Specify # of drones (default=%d)\n",DEFAULT_MAX_DRONES);
-//			printf(" -o:####       Specify # of clones of the entrant's organism (default=%d)\n",DEFAULT_MAX_ORGANISMS);
-			printf(" -p:org.asm    *Specify the player's organism source file\n");
-			printf(" -q            Run in quiet mode (no display)\n");
-			printf(" -s:####       Specify the randomization seed\n");
-			printf(" -z:org.asm    Show the disassembly and bytecode for this organism\n");
-			printf("\n   * means required field\n\n");
-		}
-
-		for (int i=1;i<argc;i++)
-		{
-			if (argv[i][0] == '-')
-			{
- 				if ((argv[i][2] == ':' && strlen(argv[i]) >= 3) || strlen(argv[i]) == 2)
-				{
-					switch(tolower(argv[i][1]))
-					{
-						case 'i':
-							m_maxIterations = atol(argv[i]+3);	// -i:10
-							break;
-/*
-						case 'o':
-							m_maxOrganisms = (uint16)atol(argv[i]+3);
-							if (m_maxOrganisms > DEFAULT_MAX_ORGANISMS)
-							{
-								error = "invalid number of organisms specified";
-								return(false);
-							}
-							break;
-
-						case 'n':
-							// # of drones
-							m_maxDrones = (uint16)atol(argv[i]+3);
-							if (m_maxDrones > DEFAULT_MAX_DRONES)
-							{
-								error = "invalid number of drones specified";
-								return(false);
-							}
-							break;
-*/
-						case 's':
-							m_seed = atol(argv[i]+3);
-							break;
-						case 'l':
-							m_debugFile = argv[i]+3;
-							break;
-						case 'z':
-							m_printFile = argv[i]+3;
-							break;
-						case 't':		// tournament: undocumented
-							m_tournamentFile = argv[i]+3;
-							break;
-						case 'g':
-							if (m_quiet == true)
-							{
-								error = "cannot single-step debug while in quiet mode";
-								return(false);
-							}
-							m_singleStep = true;
-							// ID is 0 to 25
-							m_singleStepID = INVALID_ID;
-							if (argv[i][3] >= 'A' && argv[i][3] <= 'Z')
-								m_singleStepID = argv[i][3]-'A';
-							else if (argv[i][3] >= 'a' && argv[i][3] <= 'z')
-								m_singleStepID = argv[i][3]-'a' + 26;
-							
-							if (m_singleStepID == INVALID_ID ||
-								m_singleStepID >= m_maxOrganisms)
-							{
-								error = "invalid debug ID specified";
-								return(false);
-							}
-							
-							break;
-							/*
-						case 'f':
-							m_foodDensity = (uint16)atol(argv[i]+3);
-							break;
-							*/
-						case 'p':
-							m_playerFile = argv[i]+3;
-							stream = fopen(m_playerFile.c_str(),"rt");
-							if (stream == NULL)
-							{
-								error = "invalid player file";
-								return(false);
-							}
-							fclose(stream);
-							break;
-/*
-						case 'd':
-							m_droneFile = argv[i]+3;
-							stream = fopen(m_droneFile.c_str(),"rt");
-							if (stream == NULL)
-							{
-								error = "invalid drone file";
-								return(false);
-							}
-							fclose(stream);
-							break;
-*/
-						case 'q':
-							if (m_singleStep == true)
-							{
-								error = "cannot single-step debug while in quiet mode";
-								return(false);
-							}
-							m_quiet = true;
-							break;
-						default:
-							error = (std::string)"invalid parameter (" + argv[i] +(std::string)")";
-							return(false);
-					}
-				}
-				else
-				{
-					error = (std::string)"invalid parameter syntax (" + argv[i] +(std::string)")";
-					return(false);
-				}
-			}
-			else
-			{
-				error = (std::string)"invalid option: " + argv[i];
-				return(false);
-			}
-		}
-
-		return(true);
-	}
-
-	uint32 getMaxIterations(void) const
-	{
-		return(m_maxIterations);
-	}
-
-	uint16 getMaxOrganisms(void) const
-	{
-		return(m_maxOrganisms);
-	}
-
-	uint16 getMaxDrones(void) const
-	{
-		return(m_maxDrones);
-	}
-
-	uint32 getFoodDensity(void) const
-	{
-		return(m_foodDensity);
-	}
-
-	uint32 getSeed(void) const
-	{
-		return(m_seed);
-	}
-
-	sint32 getSingleStepID(void) const
-	{
-		return(m_singleStepID);
-	}
-
-	std::string getDebug(void) const
-	{
-		return(m_debugFile);
-	}
-
-	std::string getPlayerFile(void) const
-	{
-		return(m_playerFile);
-	}
-
-	std::string getDroneFile(void) const
-	{
-		return(m_droneFile);
-	}
-
-	std::string getPrintFile(void) const
-	{
-		return(m_printFile);
-	}
-
-	std::string getTournamentFile(void) const
-	{
-		return(m_tournamentFile);
-	}
-
-	bool getSingleStep(void) const
-	{
-		return(m_singleStep);
-	}
-
-	bool getQuiet(void) const
-	{
-		return(m_quiet);
-	}
-
-	void setSeed(uint32 seed)
-	{
-		m_seed = seed;
-	}
-
-	void setQuiet(bool quiet)
-	{
-		m_quiet = quiet;
-	}
-
-private:
-	uint32			m_maxIterations;
-	uint16			m_maxOrganisms;
-	uint16			m_maxDrones;
-	uint16			m_foodDensity;
-	uint32			m_seed;
-	std::string		m_debugFile;
-	std::string		m_printFile;
-	std::string		m_playerFile;
-	std::string		m_droneFile;
-	std::string		m_tournamentFile;
-	bool			m_singleStep;
-	bool			m_quiet;
-	uint32			m_singleStepID;
-};
-
-struct NANORG_RESULT
-{
-	NANORG_RESULT(double score, std::string moduleInfo, std::string result)
-	{
-		this->totalScore = score;
-		this->moduleInfo = moduleInfo;
-		this->result = result;
-	}
-
-	double			totalScore;
-	std::string		moduleInfo;
-	std::string		result;
-};
-
-inline bool operator==(const NANORG_RESULT &a,const NANORG_RESULT &b)
-{
-	return(a.totalScore == b.totalScore);
-}
-
-inline bool operator<(const NANORG_RESULT &a,const NANORG_RESULT &b)
-{
-	return(a.totalScore < b.totalScore);
-}
-
-#endif // #ifndef _SETTINGS_H_
+//----------------------------------------------------------------------------
+//
+// settings.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer. 
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution. 
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission. 
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef _SETTINGS_H_
+
+#define _SETTINGS_H_
+
+#include <stdio.h>
+#include <time.h>
+#include <stdlib.h>
+#include <string>
+#include <cstring>
+#include <cctype>
+
+#include "types.h"
+#include "constants.h"
+
+class Settings
+{
+public:
+	Settings()
+	{
+		m_maxIterations = DEFAULT_MAX_ITERATIONS;
+		m_maxOrganisms = DEFAULT_MAX_ORGANISMS;
+		m_maxDrones = DEFAULT_MAX_DRONES;
+		m_foodDensity = DEFAULT_FOOD_DENSITY;
+		m_singleStepID = INVALID_ID;
+		m_singleStep = false;
+		m_seed = (uint32)time(NULL);
+		m_quiet = false;
+		m_numThreads = 0;
+		m_screenIterations = 0;
+		m_screenPercent = DEFAULT_SCREEN_PERCENT;
+		m_seedTolerance = DEFAULT_SEED_TOLERANCE;
+		m_attachTick = 0;
+		m_attachEnergy = 0;
+		m_attachPoked = false;
+		m_saveAtTick = INVALID_TICK;
+		m_traceDrop = false;
+		m_profileRuns = 1;
+		m_ledger = false;
+		m_phases = false;
+		m_perf = false;
+		m_cycles = false;
+		m_sleep = false;
+		m_fps = 0;
+		m_frameTicks = 1;
+		m_verifyRuns = 0;
+		m_fuzzCases = 0;
+		m_fuzzDir = DEFAULT_FUZZ_DIR;
+		m_traceOrgsSet = false;
+		m_traceFirstTick = 0;
+		m_traceLastTick = INVALID_TICK;
+		m_traceFirstIP = 0;
+		m_traceLastIP = MAX_DNA-1;
+		m_traceClasses = TRACE_CLASS_ALL;
+	}
+	
+	bool LoadSettings(int argc, char *argv[], std::string &error)
+	{
+		FILE *stream;
+
+		if (argc == 1)
+		{
+			printf("\nSymantec 2006 University Programming Competition\n"); 
+			printf("(C)Copyright 2006, Symantec Corporation\n");
+//			printf("by Carey Nachenberg\n");
+			printf("\nusage: contest06 -option1:value1 -option2:value2 ...\n\n");
+//			printf(" -d:drone.asm  *Specify the drone's DNA\n");
+//			printf(" -f:##         Specify food density percentage (default=%d%%)\n",DEFAULT_FOOD_DENSITY);
+			printf(" -g:X          Single-step debug the organism specified by X (a letter)\n");
+			printf(" -g:X@cond     ...after running silently until cond: a tick #, e<## (energy\n");
+			printf("               below ##) or poked (another organism pokes X)\n");
+			printf(" -i:####       Specify # of iterations (default=%d)\n",DEFAULT_MAX_ITERATIONS);
+			printf(" -j:##         Specify # of worker threads for sweeps (default=all CPUs)\n");
+			printf(" -l:log.trc    Log organism program trace to log.trc (see --decode-trace)\n");
+//			printf(" -n:####       Specify # of drones (default=%d)\n",DEFAULT_MAX_DRONES);
+//			printf(" -o:####       Specify # of clones of the entrant's organism (default=%d)\n",DEFAULT_MAX_ORGANISMS);
+			printf(" -p:org.asm    *Specify the player's organism source file\n");
+			printf(" -q            Run in quiet mode (no display)\n");
+			printf(" -s:####       Specify the randomization seed\n");
+			printf(" -w:sweep.txt  Evaluate a {{PARAMETER}} grid described in sweep.txt\n");
+			printf(" -z:org.asm    Show the disassembly and bytecode for this organism\n");
+			printf("\n --screen:####,##  Tournaments: pre-screen at #### iterations and run\n");
+			printf("                   only the top ##%% (default=%d) at full length\n",DEFAULT_SCREEN_PERCENT);
+			printf(" --select-seeds:cfg.txt  Pick a small seed subset that preserves the\n");
+			printf("                   ranking of a reference corpus\n");
+			printf(" --seed-tolerance:#.##   Allowed rank correlation loss (default=%.2f)\n",DEFAULT_SEED_TOLERANCE);
+			printf(" --save-at:####[,file]   Snapshot the world at tick #### (default file=%s)\n",DEFAULT_SNAPSHOT_FILE);
+			printf(" --resume:file     Continue a snapshot (same -p and -i as the original run)\n");
+			printf(" --fps:##          Draw the display at most ## times a second, running\n");
+			printf("                   flat out in between (not while debugging)\n");
+			printf(" --frame:##        Draw the display every ## ticks instead of every tick\n");
+			printf(" --profile:out.asm[,##]  Run -p over ## seeds (default 1) from -s and\n");
+			printf("                   write its source annotated with hits and energy\n");
+			printf(" --flame:out.folded[,##] ...and/or write its call stacks, weighted by\n");
+			printf("                   ticks (and by energy in out.folded.energy), for\n");
+			printf("                   flamegraph tools\n");
+			printf(" --ledger          Report where each organism's energy went: compute,\n");
+			printf("                   travel, food, charge, release on/off point, poison\n");
+			printf("                   (per entrant in tournaments)\n");
+			printf(" --phases          Time the engine's phases (dispatch, occupancy scans,\n");
+			printf("                   food respawn, debug checks, display) and report them\n");
+			printf(" --perf            Count host cycles, instructions, branch and cache\n");
+			printf("                   misses per simulated instruction (Linux)\n");
+			printf(" --cycles          Find end games that repeat (but for energy) and skip\n");
+			printf("                   ahead over the repeats; results are unchanged\n");
+			printf(" --sleep           Put organisms stuck in loops that touch nothing but\n");
+			printf("                   their registers to sleep until a neighbour pokes or\n");
+			printf("                   charges them or they run out; results are unchanged\n");
+			printf(" --bench:bench.txt[,baseline.json]  Time a benchmark corpus and write\n");
+			printf("                   JSON; flag regressions against a baseline (see\n");
+			printf("                   make bench)\n");
+			printf(" --verify:##[,engine]  Run -p over ## seeds from -s under the reference\n");
+			printf("                   engine and a candidate (default %s) in lockstep and\n",DEFAULT_VERIFY_ENGINE);
+			printf("                   report the first tick where their states differ\n");
+			printf(" --fuzz:##[,dir]   Run ## mutated DNA images (from -p, if given) and\n");
+			printf("                   world seeds (from -s) through every engine and the\n");
+			printf("                   assembler; minimise failures into dir (default %s)\n",DEFAULT_FUZZ_DIR);
+			printf("                   for at most %d ticks each (or -i)\n",DEFAULT_FUZZ_TICKS);
+			printf(" --cfg:org.asm[,graph.dot]  Report basic blocks, loops and their energy\n");
+			printf("                   per trip; optionally write the graph for Graphviz\n");
+			printf(" --decode-trace:log.trc  Print a -l trace as text; with --trace-ticks\n");
+			printf("                   and --trace-orgs, only those records (log.trc.idx\n");
+			printf("                   lets it skip straight to them)\n");
+			printf(" --trace-overflow:block|drop  When the trace writer falls behind, wait\n");
+			printf("                   (default) or drop records and count them\n");
+			printf(" --trace-orgs:A,C-E,drones,##-##  Trace only these organisms (letters\n");
+			printf("                   or IDs; drones are IDs %d-%d)\n",DEFAULT_MAX_ORGANISMS,MAX_TRACE_ORGS-1);
+			printf(" --trace-ticks:##-##  --trace-ips:##-##  Trace only these ticks/IPs\n");
+			printf(" --trace-ops:move,world,alu,flow  Trace only these instruction classes\n");
+			printf("\n   * means required field\n\n");
+		}
+
+		for (int i=1;i<argc;i++)
+		{
+			if (argv[i][0] == '-' && argv[i][1] == '-')
+			{
+				if (LoadLongSetting(argv[i]+2,error) == false)
+					return(false);
+			}
+			else if (argv[i][0] == '-')
+			{
+ 				if ((argv[i][2] == ':' && strlen(argv[i]) >= 3) || strlen(argv[i]) == 2)
+				{
+					switch(tolower(argv[i][1]))
+					{
+						case 'i':
+							m_maxIterations = atol(argv[i]+3);	// -i:10
+							break;
+/*
+						case 'o':
+							m_maxOrganisms = (uint16)atol(argv[i]+3);
+							if (m_maxOrganisms > DEFAULT_MAX_ORGANISMS)
+							{
+								error = "invalid number of organisms specified";
+								return(false);
+							}
+							break;
+
+						case 'n':
+							// # of drones
+							m_maxDrones = (uint16)atol(argv[i]+3);
+							if (m_maxDrones > DEFAULT_MAX_DRONES)
+							{
+								error = "invalid number of drones specified";
+								return(false);
+							}
+							break;
+*/
+						case 's':
+							m_seed = atol(argv[i]+3);
+							break;
+						case 'l':
+							m_debugFile = argv[i]+3;
+							break;
+						case 'z':
+							m_printFile = argv[i]+3;
+							break;
+						case 't':		// tournament: undocumented
+							m_tournamentFile = argv[i]+3;
+							break;
+						case 'w':
+							m_sweepFile = argv[i]+3;
+							break;
+						case 'j':
+							m_numThreads = (uint16)atol(argv[i]+3);
+							break;
+						case 'g':
+							if (m_quiet == true)
+							{
+								error = "cannot single-step debug while in quiet mode";
+								return(false);
+							}
+							m_singleStep = true;
+							// ID is 0 to 25
+							m_singleStepID = INVALID_ID;
+							if (argv[i][3] >= 'A' && argv[i][3] <= 'Z')
+								m_singleStepID = argv[i][3]-'A';
+							else if (argv[i][3] >= 'a' && argv[i][3] <= 'z')
+								m_singleStepID = argv[i][3]-'a' + 26;
+							
+							if (m_singleStepID == INVALID_ID ||
+								m_singleStepID >= m_maxOrganisms ||
+								(argv[i][4] != 0 && argv[i][4] != '@'))
+							{
+								error = "invalid debug ID specified";
+								return(false);
+							}
+
+							if (argv[i][4] == '@' && 
+								LoadAttachCondition(argv[i]+5,error) == false)
+								return(false);
+							
+							break;
+							/*
+						case 'f':
+							m_foodDensity = (uint16)atol(argv[i]+3);
+							break;
+							*/
+						case 'p':
+							m_playerFile = argv[i]+3;
+							stream = fopen(m_playerFile.c_str(),"rt");
+							if (stream == NULL)
+							{
+								error = "invalid player file";
+								return(false);
+							}
+							fclose(stream);
+							break;
+/*
+						case 'd':
+							m_droneFile = argv[i]+3;
+							stream = fopen(m_droneFile.c_str(),"rt");
+							if (stream == NULL)
+							{
+								error = "invalid drone file";
+								return(false);
+							}
+							fclose(stream);
+							break;
+*/
+						case 'q':
+							if (m_singleStep == true)
+							{
+								error = "cannot single-step debug while in quiet mode";
+								return(false);
+							}
+							m_quiet = true;
+							break;
+						default:
+							error = (std::string)"invalid parameter (" + argv[i] +(std::string)")";
+							return(false);
+					}
+				}
+				else
+				{
+					error = (std::string)"invalid parameter syntax (" + argv[i] +(std::string)")";
+					return(false);
+				}
+			}
+			else
+			{
+				error = (std::string)"invalid option: " + argv[i];
+				return(false);
+			}
+		}
+
+		return(true);
+	}
+
+	// -g:X@cond: run at full speed until cond holds, then attach the debugger
+	bool LoadAttachCondition(const std::string &cond, std::string &error)
+	{
+		unsigned int val;
+
+		if (cond == "poked")
+			m_attachPoked = true;
+		else if (sscanf(cond.c_str(),"e<%u",&val) == 1 || 
+				 sscanf(cond.c_str(),"energy<%u",&val) == 1)
+			m_attachEnergy = val;
+		else if (cond.length() && isdigit(cond[0]) && sscanf(cond.c_str(),"%u",&val) == 1)
+			m_attachTick = val;
+		else
+		{
+			error = "invalid debug condition (@" + cond + ")";
+			return(false);
+		}
+
+		return(true);
+	}
+
+	// --name or --name:value options
+	bool LoadLongSetting(const std::string &arg, std::string &error)
+	{
+		std::string name = arg, value;
+		size_t colon = arg.find(':');
+
+		if (colon != std::string::npos)
+		{
+			name = arg.substr(0,colon);
+			value = arg.substr(colon+1);
+		}
+
+		if (name == "screen")
+		{
+			// --screen:iterations[,percent]
+			unsigned int iterations = 0, percent = DEFAULT_SCREEN_PERCENT;
+			if (sscanf(value.c_str(),"%u,%u",&iterations,&percent) < 1 ||
+				iterations == 0 || percent == 0 || percent > 100)
+			{
+				error = "invalid screening parameters (--" + arg + ")";
+				return(false);
+			}
+			m_screenIterations = iterations;
+			m_screenPercent = (uint16)percent;
+		}
+		else if (name == "fps" || name == "frame")
+		{
+			// --fps:frames a second, --frame:ticks a frame; the last one given
+			unsigned int n;
+			if (sscanf(value.c_str(),"%u",&n) != 1 || n == 0)
+			{
+				error = "invalid display rate (--" + arg + ")";
+				return(false);
+			}
+			m_fps = (name == "fps") ? n : 0;
+			m_frameTicks = (name == "frame") ? n : 1;
+		}
+		else if (name == "select-seeds")
+		{
+			m_seedSelectFile = value;
+		}
+		else if (name == "save-at")
+		{
+			// --save-at:tick[,file]
+			unsigned int tick;
+			size_t comma = value.find(',');
+			if (sscanf(value.c_str(),"%u",&tick) != 1 || tick == INVALID_TICK ||
+				(comma != std::string::npos && comma+1 == value.length()))
+			{
+				error = "invalid snapshot tick (--" + arg + ")";
+				return(false);
+			}
+			m_saveAtTick = tick;
+			m_snapshotFile = (comma != std::string::npos) ? value.substr(comma+1) : DEFAULT_SNAPSHOT_FILE;
+		}
+		else if (name == "profile" || name == "flame")
+		{
+			// --profile:out.asm[,runs] --flame:out.folded[,runs]
+			size_t comma = value.find(',');
+			unsigned int runs = m_profileRuns;
+			std::string &file = (name == "profile") ? m_profileFile : m_flameFile;
+			file = value.substr(0,comma);
+			if (file.length() == 0 ||
+				(comma != std::string::npos && (sscanf(value.c_str()+comma+1,"%u",&runs) != 1 || runs == 0)))
+			{
+				error = "invalid profile options (--" + arg + ")";
+				return(false);
+			}
+			m_profileRuns = runs;
+		}
+		else if (name == "cfg")
+		{
+			// --cfg:org.asm[,graph.dot]
+			size_t comma = value.find(',');
+			m_cfgFile = value.substr(0,comma);
+			m_cfgDotFile = (comma != std::string::npos) ? value.substr(comma+1) : "";
+			if (m_cfgFile.length() == 0 || (comma != std::string::npos && m_cfgDotFile.length() == 0))
+			{
+				error = "invalid control flow options (--" + arg + ")";
+				return(false);
+			}
+		}
+		else if (name == "ledger")
+		{
+			m_ledger = true;
+		}
+		else if (name == "phases")
+		{
+			m_phases = true;
+		}
+		else if (name == "perf")
+		{
+			m_perf = true;
+		}
+		else if (name == "cycles")
+		{
+			m_cycles = true;
+		}
+		else if (name == "sleep")
+		{
+			m_sleep = true;
+		}
+		else if (name == "bench")
+		{
+			// --bench:bench.txt[,baseline.json]
+			size_t comma = value.find(',');
+			m_benchFile = value.substr(0,comma);
+			m_benchBaseline = (comma != std::string::npos) ? value.substr(comma+1) : "";
+			if (m_benchFile.length() == 0)
+			{
+				error = "invalid benchmark options (--" + arg + ")";
+				return(false);
+			}
+		}
+		else if (name == "verify")
+		{
+			// --verify:runs[,engine]
+			size_t comma = value.find(',');
+			unsigned int runs = 0;
+			m_verifyEngine = (comma != std::string::npos) ? value.substr(comma+1) : DEFAULT_VERIFY_ENGINE;
+			if (sscanf(value.c_str(),"%u",&runs) != 1 || runs == 0 || m_verifyEngine.length() == 0)
+			{
+				error = "invalid verification options (--" + arg + ")";
+				return(false);
+			}
+			m_verifyRuns = runs;
+		}
+		else if (name == "fuzz")
+		{
+			// --fuzz:cases[,dir]
+			size_t comma = value.find(',');
+			unsigned int cases = 0;
+			m_fuzzDir = (comma != std::string::npos) ? value.substr(comma+1) : DEFAULT_FUZZ_DIR;
+			if (sscanf(value.c_str(),"%u",&cases) != 1 || cases == 0 || m_fuzzDir.length() == 0)
+			{
+				error = "invalid fuzzing options (--" + arg + ")";
+				return(false);
+			}
+			m_fuzzCases = cases;
+		}
+		else if (name == "resume")
+		{
+			m_resumeFile = value;
+		}
+		else if (name == "decode-trace")
+		{
+			m_decodeTraceFile = value;
+		}
+		else if (name == "trace-overflow")
+		{
+			if (value != "block" && value != "drop")
+			{
+				error = "invalid trace overflow policy (--" + arg + ")";
+				return(false);
+			}
+			m_traceDrop = value == "drop";
+		}
+		else if (name == "trace-orgs")
+		{
+			if (LoadTraceOrgs(value) == false)
+			{
+				error = "invalid organism list (--" + arg + ")";
+				return(false);
+			}
+		}
+		else if (name == "trace-ticks")
+		{
+			if (ParseRange(value,INVALID_TICK-1,m_traceFirstTick,m_traceLastTick) == false)
+			{
+				error = "invalid tick range (--" + arg + ")";
+				return(false);
+			}
+		}
+		else if (name == "trace-ips")
+		{
+			uint32 first, last;
+			if (ParseRange(value,MAX_DNA-1,first,last) == false)
+			{
+				error = "invalid IP range (--" + arg + ")";
+				return(false);
+			}
+			m_traceFirstIP = (uint16)first;
+			m_traceLastIP = (uint16)last;
+		}
+		else if (name == "trace-ops")
+		{
+			m_traceClasses = 0;
+			size_t start = 0;
+			while (start <= value.length())
+			{
+				size_t comma = value.find(',',start);
+				std::string c = value.substr(start,comma == std::string::npos ? std::string::npos : comma-start);
+				if (c == "move")
+					m_traceClasses |= TRACE_CLASS_MOVE;
+				else if (c == "world")
+					m_traceClasses |= TRACE_CLASS_WORLD;
+				else if (c == "alu")
+					m_traceClasses |= TRACE_CLASS_ALU;
+				else if (c == "flow")
+					m_traceClasses |= TRACE_CLASS_FLOW;
+				else
+				{
+					error = "invalid instruction class " + c + " (--" + arg + ")";
+					return(false);
+				}
+				if (comma == std::string::npos)
+					break;
+				start = comma+1;
+			}
+		}
+		else if (name == "seed-tolerance")
+		{
+			m_seedTolerance = atof(value.c_str());
+			if (m_seedTolerance < 0 || m_seedTolerance >= 1)
+			{
+				error = "invalid seed tolerance (--" + arg + ")";
+				return(false);
+			}
+		}
+		else
+		{
+			error = "invalid parameter (--" + arg + ")";
+			return(false);
+		}
+
+		return(true);
+	}
+
+	// "first-last", "first-" or "n"
+	bool ParseRange(const std::string &value, uint32 max, uint32 &first, uint32 &last)
+	{
+		unsigned int a, b;
+		char dash;
+		int n = sscanf(value.c_str(),"%u%c%u",&a,&dash,&b);
+
+		if (n == 1 && value.find('-') == std::string::npos)
+			b = a;
+		else if (n == 2 && dash == '-' && value[value.length()-1] == '-')
+			b = max;
+		else if (n != 3 || dash != '-')
+			return(false);
+
+		if (a > b || b > max)
+			return(false);
+		first = a;
+		last = b;
+		return(true);
+	}
+
+	// organism IDs: clones are letters A-Z a-z or 0-based numbers, drones
+	// follow the clones; "drones" means all of them
+
+	bool LoadTraceOrgs(const std::string &list)
+	{
+		for (int i=0;i<MAX_TRACE_ORGS;i++)
+			m_traceOrgs[i] = false;
+		m_traceOrgsSet = true;
+
+		size_t start = 0;
+		while (start <= list.length())
+		{
+			size_t comma = list.find(',',start);
+			std::string item = list.substr(start,comma == std::string::npos ? std::string::npos : comma-start);
+			uint32 first, last;
+
+			if (item == "drones")
+			{
+				first = DEFAULT_MAX_ORGANISMS;
+				last = MAX_TRACE_ORGS-1;
+			}
+			else if (item.length() > 0 && isalpha(item[0]))
+			{
+				// A or A-E
+				first = isupper(item[0]) ? item[0]-'A' : item[0]-'a'+26;
+				last = first;
+				if (item.length() == 3 && item[1] == '-' && isalpha(item[2]))
+					last = isupper(item[2]) ? item[2]-'A' : item[2]-'a'+26;
+				else if (item.length() != 1)
+					return(false);
+				if (first > last || last >= DEFAULT_MAX_ORGANISMS)
+					return(false);
+			}
+			else if (ParseRange(item,MAX_TRACE_ORGS-1,first,last) == false)
+				return(false);
+
+			for (uint32 i=first;i<=last;i++)
+				m_traceOrgs[i] = true;
+
+			if (comma == std::string::npos)
+				break;
+			start = comma+1;
+		}
+
+		return(true);
+	}
+
+	uint32 getMaxIterations(void) const
+	{
+		return(m_maxIterations);
+	}
+
+	void setMaxIterations(uint32 maxIterations)
+	{
+		m_maxIterations = maxIterations;
+	}
+
+	uint32 getScreenIterations(void) const
+	{
+		return(m_screenIterations);
+	}
+
+	uint16 getScreenPercent(void) const
+	{
+		return(m_screenPercent);
+	}
+
+	std::string getSeedSelectFile(void) const
+	{
+		return(m_seedSelectFile);
+	}
+
+	double getSeedTolerance(void) const
+	{
+		return(m_seedTolerance);
+	}
+
+	uint32 getSaveAtTick(void) const
+	{
+		return(m_saveAtTick);
+	}
+
+	std::string getSnapshotFile(void) const
+	{
+		return(m_snapshotFile);
+	}
+
+	std::string getResumeFile(void) const
+	{
+		return(m_resumeFile);
+	}
+
+	std::string getDecodeTraceFile(void) const
+	{
+		return(m_decodeTraceFile);
+	}
+
+	bool getTraceDrop(void) const
+	{
+		return(m_traceDrop);
+	}
+
+	bool getTraceOrgsSet(void) const
+	{
+		return(m_traceOrgsSet);
+	}
+
+	// without --trace-orgs every clone but no drone is traced
+	bool getTraceOrg(uint16 id) const
+	{
+		if (m_traceOrgsSet == false)
+			return(id < m_maxOrganisms);
+		return(id < MAX_TRACE_ORGS && m_traceOrgs[id]);
+	}
+
+	uint32 getTraceFirstTick(void) const
+	{
+		return(m_traceFirstTick);
+	}
+
+	uint32 getTraceLastTick(void) const
+	{
+		return(m_traceLastTick);
+	}
+
+	uint16 getTraceFirstIP(void) const
+	{
+		return(m_traceFirstIP);
+	}
+
+	uint16 getTraceLastIP(void) const
+	{
+		return(m_traceLastIP);
+	}
+
+	uint16 getTraceClasses(void) const
+	{
+		return(m_traceClasses);
+	}
+
+	uint16 getMaxOrganisms(void) const
+	{
+		return(m_maxOrganisms);
+	}
+
+	uint16 getMaxDrones(void) const
+	{
+		return(m_maxDrones);
+	}
+
+	uint32 getFoodDensity(void) const
+	{
+		return(m_foodDensity);
+	}
+
+	uint32 getSeed(void) const
+	{
+		return(m_seed);
+	}
+
+	sint32 getSingleStepID(void) const
+	{
+		return(m_singleStepID);
+	}
+
+	std::string getDebug(void) const
+	{
+		return(m_debugFile);
+	}
+
+	std::string getPlayerFile(void) const
+	{
+		return(m_playerFile);
+	}
+
+	std::string getDroneFile(void) const
+	{
+		return(m_droneFile);
+	}
+
+	std::string getPrintFile(void) const
+	{
+		return(m_printFile);
+	}
+
+	std::string getProfileFile(void) const
+	{
+		return(m_profileFile);
+	}
+
+	std::string getFlameFile(void) const
+	{
+		return(m_flameFile);
+	}
+
+	uint32 getProfileRuns(void) const
+	{
+		return(m_profileRuns);
+	}
+
+	bool getLedger(void) const
+	{
+		return(m_ledger);
+	}
+
+	bool getPhases(void) const
+	{
+		return(m_phases);
+	}
+
+	bool getPerf(void) const
+	{
+		return(m_perf);
+	}
+
+	bool getCycles(void) const
+	{
+		return(m_cycles);
+	}
+
+	bool getSleep(void) const
+	{
+		return(m_sleep);
+	}
+
+	uint32 getFPS(void) const
+	{
+		return(m_fps);
+	}
+
+	uint32 getFrameTicks(void) const
+	{
+		return(m_frameTicks);
+	}
+
+	std::string getBenchFile(void) const
+	{
+		return(m_benchFile);
+	}
+
+	std::string getBenchBaseline(void) const
+	{
+		return(m_benchBaseline);
+	}
+
+	uint32 getVerifyRuns(void) const
+	{
+		return(m_verifyRuns);
+	}
+
+	std::string getVerifyEngine(void) const
+	{
+		return(m_verifyEngine);
+	}
+
+	uint32 getFuzzCases(void) const
+	{
+		return(m_fuzzCases);
+	}
+
+	std::string getFuzzDir(void) const
+	{
+		return(m_fuzzDir);
+	}
+
+	std::string getCfgFile(void) const
+	{
+		return(m_cfgFile);
+	}
+
+	std::string getCfgDotFile(void) const
+	{
+		return(m_cfgDotFile);
+	}
+
+	std::string getTournamentFile(void) const
+	{
+		return(m_tournamentFile);
+	}
+
+	std::string getSweepFile(void) const
+	{
+		return(m_sweepFile);
+	}
+
+	uint16 getNumThreads(void) const
+	{
+		return(m_numThreads);
+	}
+
+	bool getSingleStep(void) const
+	{
+		return(m_singleStep);
+	}
+
+	// true when -g:X@cond defers the debugger
+	bool getAttachDeferred(void) const
+	{
+		return(m_attachTick != 0 || m_attachEnergy != 0 || m_attachPoked);
+	}
+
+	uint32 getAttachTick(void) const
+	{
+		return(m_attachTick);
+	}
+
+	sint32 getAttachEnergy(void) const
+	{
+		return(m_attachEnergy);
+	}
+
+	bool getAttachPoked(void) const
+	{
+		return(m_attachPoked);
+	}
+
+	bool getQuiet(void) const
+	{
+		return(m_quiet);
+	}
+
+	void setSeed(uint32 seed)
+	{
+		m_seed = seed;
+	}
+
+	void setQuiet(bool quiet)
+	{
+		m_quiet = quiet;
+	}
+
+private:
+	uint32			m_maxIterations;
+	uint16			m_maxOrganisms;
+	uint16			m_maxDrones;
+	uint16			m_foodDensity;
+	uint32			m_seed;
+	std::string		m_debugFile;
+	std::string		m_printFile;
+	std::string		m_profileFile;
+	std::string		m_flameFile;
+	uint32			m_profileRuns;
+	bool			m_ledger;
+	bool			m_phases;
+	bool			m_perf;
+	bool			m_cycles;
+	bool			m_sleep;
+	uint32			m_fps;
+	uint32			m_frameTicks;
+	std::string		m_benchFile;
+	std::string		m_benchBaseline;
+	uint32			m_verifyRuns;
+	std::string		m_verifyEngine;
+	uint32			m_fuzzCases;
+	std::string		m_fuzzDir;
+	std::string		m_cfgFile;
+	std::string		m_cfgDotFile;
+	std::string		m_playerFile;
+	std::string		m_droneFile;
+	std::string		m_tournamentFile;
+	std::string		m_sweepFile;
+	uint16			m_numThreads;
+	uint32			m_screenIterations;
+	uint16			m_screenPercent;
+	std::string		m_seedSelectFile;
+	double			m_seedTolerance;
+	uint32			m_saveAtTick;
+	std::string		m_snapshotFile;
+	std::string		m_resumeFile;
+	std::string		m_decodeTraceFile;
+	bool			m_traceDrop;
+	bool			m_traceOrgsSet;
+	bool			m_traceOrgs[MAX_TRACE_ORGS];
+	uint32			m_traceFirstTick;
+	uint32			m_traceLastTick;
+	uint16			m_traceFirstIP;
+	uint16			m_traceLastIP;
+	uint16			m_traceClasses;
+	uint32			m_attachTick;
+	sint32			m_attachEnergy;
+	bool			m_attachPoked;
+	bool			m_singleStep;
+	bool			m_quiet;
+	uint32			m_singleStepID;
+};
+
+struct NANORG_RESULT
+{
+	NANORG_RESULT(double score, std::string moduleInfo, std::string result)
+	{
+		this->totalScore = score;
+		this->moduleInfo = moduleInfo;
+		this->result = result;
+	}
+
+	double			totalScore;
+	std::string		moduleInfo;
+	std::string		result;
+};
+
+inline bool operator==(const NANORG_RESULT &a,const NANORG_RESULT &b)
+{
+	return(a.totalScore == b.totalScore);
+}
+
+inline bool operator<(const NANORG_RESULT &a,const NANORG_RESULT &b)
+{
+	return(a.totalScore < b.totalScore);
+}
+
+#endif // #ifndef _SETTINGS_H_
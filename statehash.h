@@ -0,0 +1,71 @@
+//----------------------------------------------------------------------------
+//
+// statehash.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef _STATEHASH_H_
+
+#define _STATEHASH_H_
+
+#include "types.h"
+
+// hashes of simulation state for comparing two runs tick by tick (--verify).
+//
+// Large arrays (DNA, the food grid) are hashed Zobrist style: the XOR of a
+// key per (slot, value), so a single write updates the hash in O(1) instead
+// of rehashing the array.  Everything else is folded in a word at a time
+// with hashWord, and the result finished with hashMix.
+
+inline uint64 hashMix(uint64 h, uint64 v)
+{
+	// splitmix64 finaliser over the running hash
+	uint64 z = h ^ (v + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2));
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return(z ^ (z >> 31));
+}
+
+// FNV-1a over 64 bit words: one multiply per word
+inline uint64 hashWord(uint64 h, uint64 v)
+{
+	return((h ^ v) * 0x100000001B3ULL);
+}
+
+inline uint64 hashKey(uint32 slot, uint16 value)
+{
+	return(hashMix(0,((uint64)slot << 16) | value));
+}
+
+
+#endif // #ifndef _STATEHASH_H_
@@ -0,0 +1,628 @@
+//----------------------------------------------------------------------------
+//
+// trace.cpp
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#endif // #ifdef WIN32
+
+#include "trace.h"
+#include "organism.h"
+#include "disasm.h"
+#include "mappedfile.h"
+
+#include <cstring>
+#include <chrono>
+
+using namespace std;
+
+bool getOperandAddress(const uint16 *instr, const uint16 *regs, int opNum, uint16 &addr)
+{
+	uint16 opcode = instr[0];
+	uint16 opValue = instr[opNum+1];
+
+	switch ((opcode >> (14-opNum*2)) & 0x3)
+	{
+		case ADDR_MODE_DNA_DIRECT:
+			addr = opValue;
+			break;
+		case ADDR_MODE_DNA_INDEXED_DIRECT:
+			{
+				uint16 reg = regs[opValue >> 12];
+				uint16 off = (opValue & OFFSET_MASK);
+				if (opcode & (1 << (11-opNum)))
+					off |= OFFSET_TOP_BIT_MASK;
+				if (off & OFFSET_TOP_BIT_MASK)
+					off |= 0xF000;
+				addr = (uint16)(reg + (sint16)off);
+			}
+			break;
+		default:
+			return(false);
+	}
+
+	return(addr < MAX_DNA);
+}
+
+TraceWriter::TraceWriter()
+{
+	m_stream = NULL;
+	m_lastTick = INVALID_TICK;
+	m_dropWhenFull = false;
+	m_dropped = m_totalDropped = 0;
+	m_index = NULL;
+	m_chunkEnd = 0;
+	m_numChunks = 0;
+	memset(&m_chunk,0,sizeof(m_chunk));
+	m_ring = new uint8[TRACE_RING_SIZE];
+	m_head = m_tail = 0;
+	m_closing = false;
+	setFilter(0,INVALID_TICK,0,MAX_DNA-1,TRACE_CLASS_ALL);
+}
+
+static uint16 getOpcodeClass(uint16 op)
+{
+	switch (op)
+	{
+		case OPCODE_TRAVEL:
+			return(TRACE_CLASS_MOVE);
+		case OPCODE_GETXY:
+		case OPCODE_ENERGY:
+		case OPCODE_SENSE:
+		case OPCODE_EAT:
+		case OPCODE_RELEASE:
+		case OPCODE_CHARGE:
+		case OPCODE_POKE:
+		case OPCODE_PEEK:
+			return(TRACE_CLASS_WORLD);
+		case OPCODE_CALL:
+		case OPCODE_RET:
+		case OPCODE_JMP:
+		case OPCODE_JL:
+		case OPCODE_JLE:
+		case OPCODE_JG:
+		case OPCODE_JGE:
+		case OPCODE_JE:
+		case OPCODE_JNE:
+		case OPCODE_JS:
+		case OPCODE_JNS:
+			return(TRACE_CLASS_FLOW);
+		default:
+			return(TRACE_CLASS_ALU);	// includes nop and invalid opcodes
+	}
+}
+
+void TraceWriter::setFilter(uint32 firstTick, uint32 lastTick, uint16 firstIP, uint16 lastIP, uint16 classes)
+{
+	// ranges become first + span so wants() needs one unsigned compare each
+	m_firstTick = firstTick;
+	m_tickSpan = lastTick - firstTick;
+	m_firstIP = firstIP;
+	m_ipSpan = lastIP - firstIP;
+
+	memset(m_opcodes,0,sizeof(m_opcodes));
+	for (uint16 op=0;op<=OPCODE_MASK;op++)
+		if (getOpcodeClass(op) & classes)
+			m_opcodes[op >> 5] |= 1u << (op & 31);
+}
+
+TraceWriter::~TraceWriter()
+{
+	if (m_stream != NULL)
+	{
+		m_closing = true;
+		if (m_writer.joinable())
+			m_writer.join();
+		fclose(m_stream);
+	}
+	if (m_index != NULL)
+	{
+		if (m_chunkEnd != 0)
+			writeChunk();
+
+		// now that the trace is complete, tie the index to it
+		TraceIndexHeader h;
+		memset(&h,0,sizeof(h));
+		memcpy(h.magic,TRACE_INDEX_MAGIC,sizeof(h.magic));
+		h.version = TRACE_INDEX_VERSION;
+		h.numOrgs = MAX_TRACE_ORGS;
+		h.numEntries = m_numChunks;
+		h.traceSize = m_head;
+		fseek(m_index,0,SEEK_SET);
+		fwrite(&h,sizeof(h),1,m_index);
+		fclose(m_index);
+	}
+	delete [] m_ring;
+}
+
+bool TraceWriter::open(const std::string &file, bool dropWhenFull, std::string &error)
+{
+	m_stream = fopen(file.c_str(),"wb");
+	if (m_stream == NULL)
+	{
+		error = "unable to create trace file " + file;
+		return(false);
+	}
+	setvbuf(m_stream,NULL,_IONBF,0);		// the ring is the buffer
+	m_dropWhenFull = dropWhenFull;
+
+	// the header is written on close; until then the index is invalid
+	m_index = fopen((file + ".idx").c_str(),"wb");
+	if (m_index == NULL)
+	{
+		error = "unable to create trace index " + file + ".idx";
+		fclose(m_stream);
+		m_stream = NULL;
+		remove(file.c_str());
+		return(false);
+	}
+	TraceIndexHeader ih;
+	memset(&ih,0,sizeof(ih));
+	fwrite(&ih,sizeof(ih),1,m_index);
+
+	TraceFileHeader h;
+	memset(&h,0,sizeof(h));
+	memcpy(h.magic,TRACE_MAGIC,sizeof(h.magic));
+	h.version = TRACE_VERSION;
+	put((const uint8 *)&h,sizeof(h));
+
+	m_writer = std::thread(&TraceWriter::writerThread,this);
+	return(true);
+}
+
+// consumer: write whatever is in the ring, at least TRACE_WRITE_BATCH bytes
+// at a time unless we are closing
+
+void TraceWriter::writerThread(void)
+{
+	for (;;)
+	{
+		bool closing = m_closing;
+		size_t tail = m_tail.load(std::memory_order_relaxed);
+		size_t avail = m_head.load(std::memory_order_acquire) - tail;
+
+		if (avail == 0 && closing)
+			break;
+		if (avail < TRACE_WRITE_BATCH && !closing)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			continue;
+		}
+
+		// up to the end of the ring; the wrapped part goes next time round
+		size_t off = tail & (TRACE_RING_SIZE-1);
+		size_t len = avail < TRACE_RING_SIZE-off ? avail : TRACE_RING_SIZE-off;
+
+		fwrite(m_ring+off,1,len,m_stream);
+		m_tail.store(tail+len,std::memory_order_release);
+	}
+}
+
+// producer: false if the record was dropped
+
+bool TraceWriter::put(const uint8 *data, size_t len)
+{
+	size_t head = m_head.load(std::memory_order_relaxed);
+
+	while (TRACE_RING_SIZE - (head - m_tail.load(std::memory_order_acquire)) < len)
+	{
+		if (m_dropWhenFull)
+			return(false);
+		std::this_thread::yield();
+	}
+
+	size_t off = head & (TRACE_RING_SIZE-1);
+	size_t first = len < TRACE_RING_SIZE-off ? len : TRACE_RING_SIZE-off;
+
+	memcpy(m_ring+off,data,first);
+	memcpy(m_ring,data+first,len-first);
+	m_head.store(head+len,std::memory_order_release);
+
+	return(true);
+}
+
+// close the current chunk and make the next record a keyframe
+
+void TraceWriter::startChunk(uint32 tick)
+{
+	if (m_chunkEnd != 0)
+		writeChunk();
+
+	memset(&m_chunk,0,sizeof(m_chunk));
+	m_chunk.firstTick = m_chunk.lastTick = tick;
+	m_chunk.offset = m_head.load(std::memory_order_relaxed);
+	m_chunkEnd = (tick / TRACE_INDEX_INTERVAL + 1) * TRACE_INDEX_INTERVAL;
+
+	for (uint32 i=0;i<m_last.size();i++)
+		m_last[i].seen = false;
+	m_lastTick = INVALID_TICK;
+}
+
+void TraceWriter::writeChunk(void)
+{
+	fwrite(&m_chunk,sizeof(m_chunk),1,m_index);
+	m_numChunks++;
+}
+
+#define PUT16(v)	{ uint16 t_ = (v); memcpy(p,&t_,2); p += 2; }
+#define PUT32(v)	{ uint32 t_ = (v); memcpy(p,&t_,4); p += 4; }
+
+void TraceWriter::record(const TraceState &st, const uint16 *dna, const std::string &name)
+{
+	uint8 rec[TRACE_MAX_RECORD], *p = rec;
+	uint16 i;
+
+	if (st.orgID >= m_last.size())
+		m_last.resize(st.orgID+1);		// new entries are zeroed: not seen
+
+	// a rewound debugger goes back in time: that starts a chunk too, so
+	// ticks only ever increase within one
+	if (m_index != NULL && (st.tick >= m_chunkEnd || st.tick < m_chunk.lastTick))
+		startChunk(st.tick);
+
+	LastState &last = m_last[st.orgID];
+	size_t offset = m_head.load(std::memory_order_relaxed);
+
+	if (m_dropped > 0)
+	{
+		*p++ = TRACE_DROPPED;
+		PUT32(m_dropped);
+	}
+
+	if (last.seen == false)
+	{
+		// name the organism, then delta against an all-zero state
+
+		size_t len = name.length() < 255 ? name.length() : 255;
+		*p++ = TRACE_NAME;
+		PUT16(st.orgID);
+		*p++ = (uint8)len;
+		memcpy(p,name.c_str(),len);
+		p += len;
+
+		memset(last.regs,0,sizeof(last.regs));
+		last.x = last.y = INVALID_COORD;
+		last.energy = 0;
+	}
+
+	const uint16 *instr = dna + st.ip;
+	uint16 regMask = 0, addr0, addr1;
+	uint8 flags = 0;
+
+	for (i=0;i<MAX_REGS;i++)
+		if (st.regs[i] != last.regs[i])
+			regMask |= 1 << i;
+	if (st.tick != m_lastTick || last.seen == false)
+		flags |= TRACE_TICK;
+	if (st.x != last.x || st.y != last.y)
+		flags |= TRACE_XY;
+	if (st.energy != last.energy - COMPUTE_ENERGY)
+		flags |= TRACE_ENERGY;
+	if (getOperandAddress(instr,st.regs,0,addr0))
+		flags |= TRACE_MEM0;
+	if (getOperandAddress(instr,st.regs,1,addr1))
+		flags |= TRACE_MEM1;
+
+	*p++ = flags;
+	PUT16(st.orgID);
+	PUT16(st.ip);
+	PUT16(instr[0]);
+	PUT16(instr[1]);
+	PUT16(instr[2]);
+	PUT16(regMask);
+	if (flags & TRACE_TICK)
+		PUT32(st.tick);
+	if (flags & TRACE_XY)
+	{
+		PUT16(st.x);
+		PUT16(st.y);
+	}
+	if (flags & TRACE_ENERGY)
+		PUT32((uint32)st.energy);
+	for (i=0;i<MAX_REGS;i++)
+		if (regMask & (1 << i))
+			PUT16(st.regs[i]);
+	if (flags & TRACE_MEM0)
+		PUT16(dna[addr0]);
+	if (flags & TRACE_MEM1)
+		PUT16(dna[addr1]);
+
+	if (put(rec,p-rec) == false)
+	{
+		// lost; resynchronise this organism with a full record next time
+		++m_dropped;
+		++m_totalDropped;
+		last.seen = false;
+		return;
+	}
+
+	if (m_index != NULL)
+	{
+		m_chunk.lastTick = st.tick;
+		if (st.orgID < MAX_TRACE_ORGS && m_chunk.orgOffset[st.orgID] == 0)
+			m_chunk.orgOffset[st.orgID] = offset;
+	}
+
+	m_dropped = 0;
+	last.seen = true;
+	m_lastTick = st.tick;
+	memcpy(last.regs,st.regs,sizeof(last.regs));
+	last.x = st.x;
+	last.y = st.y;
+	last.energy = st.energy;
+}
+
+// reads from a mapped range of the trace
+
+class TraceReader
+{
+public:
+	TraceReader(const uint8 *data, size_t len)
+	{
+		m_p = data;
+		m_end = data + len;
+	}
+	bool get(void *data, size_t len)
+	{
+		if ((size_t)(m_end - m_p) < len)
+			return(false);
+		memcpy(data,m_p,len);
+		m_p += len;
+		return(true);
+	}
+	bool get8(uint8 &v)		{ return(get(&v,1)); }
+	bool get16(uint16 &v)	{ return(get(&v,2)); }
+	bool get32(uint32 &v)	{ return(get(&v,4)); }
+
+private:
+	const uint8	*m_p, *m_end;
+};
+
+// renders each record exactly as the text trace used to: the debugger's
+// status lines followed by a blank line
+
+class TraceDecoder
+{
+public:
+	TraceDecoder(FILE *out, const TraceQuery &query) : m_query(query)
+	{
+		m_out = out;
+		m_tick = 0;
+		memset(m_dna,0,sizeof(m_dna));
+	}
+
+	// false if the range is truncated or corrupt.  A chunk's ticks never
+	// go back, so once past the last one wanted it can be abandoned.
+	bool decode(const uint8 *data, size_t len, bool chunk);
+
+private:
+	bool selected(uint16 orgID)
+	{
+		return(m_tick - m_query.firstTick <= m_query.lastTick - m_query.firstTick &&
+			   orgID < MAX_TRACE_ORGS && m_query.orgs[orgID]);
+	}
+
+private:
+	struct OrgState
+	{
+		string	name;
+		uint16	regs[MAX_REGS];
+		uint16	x, y;
+		sint32	energy;
+	};
+
+	FILE				*m_out;
+	const TraceQuery	&m_query;
+	vector<OrgState>	m_orgs;
+	uint16				m_dna[MAX_DNA];
+	vector<string>		m_lines;
+	uint32				m_tick;
+};
+
+bool TraceDecoder::decode(const uint8 *data, size_t len, bool chunk)
+{
+	TraceReader r(data,len);
+	uint8 flags;
+
+	while (r.get8(flags))
+	{
+		uint16 orgID, ip, regMask, i;
+		bool ok;
+
+		if (flags & TRACE_DROPPED)
+		{
+			uint32 count;
+			if (r.get32(count) == false)
+				return(false);
+			if (m_tick - m_query.firstTick <= m_query.lastTick - m_query.firstTick)
+				fprintf(m_out,"(%u trace records dropped)\n\n",count);
+			continue;
+		}
+
+		if (r.get16(orgID) == false)
+			return(false);			// cut off
+		if (orgID >= m_orgs.size())
+			m_orgs.resize(orgID+1);
+
+		if (flags & TRACE_NAME)
+		{
+			uint8 len;
+			char name[256];
+
+			ok = r.get8(len) && r.get(name,len);
+			if (ok)
+			{
+				OrgState &o = m_orgs[orgID];
+				o.name.assign(name,len);
+				memset(o.regs,0,sizeof(o.regs));
+				o.x = o.y = INVALID_COORD;
+				o.energy = 0;
+			}
+		}
+		else
+		{
+			OrgState &o = m_orgs[orgID];
+			uint16 instr[3], x, y, mem;
+			uint32 v;
+
+			ok = r.get16(ip) && ip <= MAX_DNA-INSTR_SLOTS && r.get(instr,sizeof(instr)) && r.get16(regMask);
+			if (ok && (flags & TRACE_TICK))
+			{
+				ok = r.get32(m_tick);
+
+				if (ok && chunk && m_tick > m_query.lastTick)
+					return(true);
+			}
+			if (ok && (flags & TRACE_XY) && (ok = r.get16(x) && r.get16(y)))
+			{
+				o.x = x;
+				o.y = y;
+			}
+			if (ok && (flags & TRACE_ENERGY))
+			{
+				if ((ok = r.get32(v)))
+					o.energy = (sint32)v;
+			}
+			else if (ok)
+				o.energy -= COMPUTE_ENERGY;
+			for (i=0;ok && i<MAX_REGS;i++)
+				if (regMask & (1 << i))
+					ok = r.get16(o.regs[i]);
+
+			// rebuild just the DNA the disassembler will look at
+
+			if (ok)
+			{
+				uint16 addr;
+
+				memcpy(m_dna+ip,instr,sizeof(instr));
+				if (ok && (flags & TRACE_MEM0) && (ok = r.get16(mem)) && getOperandAddress(instr,o.regs,0,addr))
+					m_dna[addr] = mem;
+				if (ok && (flags & TRACE_MEM1) && (ok = r.get16(mem)) && getOperandAddress(instr,o.regs,1,addr))
+					m_dna[addr] = mem;
+			}
+
+			if (ok && selected(orgID))
+			{
+				DisAsm d(m_dna,o.regs);
+				Organism::formatDisplayLines(m_lines,o.name,orgID,o.x,o.y,o.energy,ip,o.regs,d);
+				for (i=0;i<m_lines.size();i++)
+					fprintf(m_out,"%s\n",m_lines[i].c_str());
+				fprintf(m_out,"\n");
+			}
+		}
+
+		if (ok == false)
+			return(false);
+	}
+
+	return(true);
+}
+
+bool decodeTrace(const std::string &file, FILE *out, const TraceQuery &query, std::string &error)
+{
+	MappedFile trace, index;
+
+	if (trace.open(file) == false)
+	{
+		error = "unable to read " + file;
+		return(false);
+	}
+
+	const uint8 *data = trace.getData();
+	size_t size = trace.getSize();
+	const TraceFileHeader *h = (const TraceFileHeader *)data;
+
+	if (size < sizeof(TraceFileHeader) || memcmp(h->magic,TRACE_MAGIC,sizeof(h->magic)) != 0)
+	{
+		error = file + " is not a trace file";
+		return(false);
+	}
+	if (h->version != TRACE_VERSION)
+	{
+		error = file + " was written by an incompatible version";
+		return(false);
+	}
+
+	// without a usable index, decode the lot and filter the output
+
+	const TraceIndexHeader *ih = NULL;
+	if (index.open(file + ".idx"))
+	{
+		ih = (const TraceIndexHeader *)index.getData();
+		if (index.getSize() < sizeof(TraceIndexHeader) ||
+			memcmp(ih->magic,TRACE_INDEX_MAGIC,sizeof(ih->magic)) != 0 ||
+			ih->version != TRACE_INDEX_VERSION || ih->numOrgs != MAX_TRACE_ORGS ||
+			ih->traceSize != size ||
+			index.getSize() != sizeof(TraceIndexHeader) + (size_t)ih->numEntries * sizeof(TraceIndexEntry))
+			ih = NULL;
+	}
+
+	TraceDecoder decoder(out,query);
+	bool ok = true;
+
+	if (ih == NULL)
+		ok = decoder.decode(data + sizeof(TraceFileHeader),size - sizeof(TraceFileHeader),false);
+	else
+	{
+		const TraceIndexEntry *entries = (const TraceIndexEntry *)(ih + 1);
+
+		for (uint32 i=0;ok && i<ih->numEntries;i++)
+		{
+			const TraceIndexEntry &e = entries[i];
+			uint64 end = (i+1 < ih->numEntries) ? entries[i+1].offset : size;
+			uint64 start = end;
+
+			if (e.lastTick < query.firstTick || e.firstTick > query.lastTick)
+				continue;
+
+			// begin at the earliest selected organism; the others' records
+			// before that are skipped and the rest are parsed but not shown
+			for (uint32 j=0;j<MAX_TRACE_ORGS;j++)
+				if (query.orgs[j] && e.orgOffset[j] != 0 && e.orgOffset[j] < start)
+					start = e.orgOffset[j];
+
+			if (start > end || end > size)
+				ok = false;
+			else if (start < end)
+				ok = decoder.decode(data + start,(size_t)(end - start),true);
+		}
+	}
+
+	if (ok == false)
+		error = file + " is truncated or corrupt";
+	return(ok);
+}
@@ -0,0 +1,209 @@
+//----------------------------------------------------------------------------
+//
+// trace.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+#ifndef _TRACE_H_
+
+#define _TRACE_H_
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+
+#include "types.h"
+#include "constants.h"
+
+// -l trace file: a TraceFileHeader, then one variable-length record per
+// traced instruction.  Each record starts with a flags byte:
+//
+//	TRACE_NAME			uint16 org, uint8 len, len chars: the org's name
+//	TRACE_DROPPED		uint32 count: records lost to a full ring buffer
+//	otherwise			uint16 org, uint16 ip, uint16 words[3], uint16 regMask,
+//						then, as flagged, uint32 tick, uint16 x, uint16 y,
+//						sint32 energy, one uint16 per regMask bit, and the
+//						DNA values read by operands 0 and 1
+//
+// Registers, position and energy are deltas against the same organism's
+// previous record; a tick is only written when it changes.  Energy is only
+// written when it did not simply drop by COMPUTE_ENERGY.  After a dropped
+// record the organism is named again and its state is sent in full.
+//
+// log.trc.idx is a sparse index into the trace: a TraceIndexHeader, then one
+// TraceIndexEntry per chunk of up to TRACE_INDEX_INTERVAL ticks.  A chunk is
+// a keyframe: each organism's first record in it is named, carries its tick
+// and sends its state in full, so decoding can start at the chunk, or at any
+// one organism's first record in it, without reading what came before.
+
+#define TRACE_NAME			0x01
+#define TRACE_TICK			0x02
+#define TRACE_XY			0x04
+#define TRACE_ENERGY		0x08
+#define TRACE_MEM0			0x10
+#define TRACE_MEM1			0x20
+#define TRACE_DROPPED		0x40
+
+#define TRACE_MAX_RECORD	384				// name + instruction record
+#define TRACE_RING_SIZE		(4*1024*1024)	// power of 2
+#define TRACE_WRITE_BATCH	(256*1024)
+
+struct TraceFileHeader
+{
+	char	magic[8];			// TRACE_MAGIC
+	uint32	version;			// TRACE_VERSION
+	uint32	reserved;
+};
+
+struct TraceIndexHeader
+{
+	char	magic[8];			// TRACE_INDEX_MAGIC
+	uint32	version;			// TRACE_INDEX_VERSION
+	uint32	numOrgs;			// MAX_TRACE_ORGS
+	uint32	numEntries;
+	uint32	reserved;
+	uint64	traceSize;			// must match the trace it indexes
+};
+
+struct TraceIndexEntry
+{
+	uint32	firstTick, lastTick;
+	uint64	offset;						// first record of the chunk
+	uint64	orgOffset[MAX_TRACE_ORGS];	// each organism's first, 0 if none
+};
+
+// what a trace record knows about an organism
+
+struct TraceState
+{
+	uint32	tick;
+	uint16	orgID;
+	uint16	ip;
+	uint16	regs[MAX_REGS];
+	uint16	x, y;
+	sint32	energy;
+};
+
+// records are built on the simulation thread and pushed into a single
+// producer, single consumer ring; a background thread drains it to the file
+// in large writes.  When the ring is full the simulation either waits or,
+// with dropWhenFull, discards the record and counts it.
+
+class TraceWriter
+{
+public:
+	TraceWriter();
+	~TraceWriter();
+
+	bool open(const std::string &file, bool dropWhenFull, std::string &error);
+	void setFilter(uint32 firstTick, uint32 lastTick, uint16 firstIP, uint16 lastIP, uint16 classes);
+	void record(const TraceState &st, const uint16 *dna, const std::string &name);
+
+	// checked before anything is built; the organism filter is applied by
+	// only giving the writer to the selected organisms
+	bool wants(uint32 tick, uint16 ip, uint16 instr) const
+	{
+		uint16 op = instr & OPCODE_MASK;
+		return(tick - m_firstTick <= m_tickSpan &&
+			   (uint16)(ip - m_firstIP) <= m_ipSpan &&
+			   (m_opcodes[op >> 5] & (1u << (op & 31))) != 0);
+	}
+	uint32 getDropped(void)
+	{
+		return(m_totalDropped);
+	}
+
+private:
+	bool put(const uint8 *data, size_t len);
+	void writerThread(void);
+	void startChunk(uint32 tick);
+	void writeChunk(void);
+
+private:
+	struct LastState
+	{
+		bool	seen;
+		uint16	regs[MAX_REGS];
+		uint16	x, y;
+		sint32	energy;
+	};
+
+	FILE					*m_stream;
+	std::vector<LastState>	m_last;		// indexed by organism ID
+	uint32					m_lastTick;
+	bool					m_dropWhenFull;
+	uint32					m_dropped;		// not yet reported in the trace
+	uint32					m_totalDropped;
+
+	FILE					*m_index;
+	TraceIndexEntry			m_chunk;		// being filled in
+	uint32					m_chunkEnd;		// first tick of the next chunk
+	uint32					m_numChunks;
+
+	uint32					m_firstTick, m_tickSpan;
+	uint16					m_firstIP, m_ipSpan;
+	uint32					m_opcodes[(OPCODE_MASK+1)/32];	// traced opcodes
+
+	uint8					*m_ring;
+	std::atomic<size_t>		m_head;			// advanced by the simulation
+	std::atomic<size_t>		m_tail;			// advanced by the writer thread
+	std::atomic<bool>		m_closing;
+	std::thread				m_writer;
+};
+
+// which records decodeTrace prints
+struct TraceQuery
+{
+	TraceQuery()
+	{
+		firstTick = 0;
+		lastTick = INVALID_TICK;
+		for (int i=0;i<MAX_TRACE_ORGS;i++)
+			orgs[i] = true;
+	}
+
+	uint32	firstTick, lastTick;
+	bool	orgs[MAX_TRACE_ORGS];
+};
+
+// the trace is mapped, not read; with an up to date log.trc.idx only the
+// chunks holding the selected ticks and organisms are touched
+bool decodeTrace(const std::string &file, FILE *out, const TraceQuery &query, std::string &error);
+
+// DNA slot addressed by an operand, if it addresses DNA at all
+bool getOperandAddress(const uint16 *instr, const uint16 *regs, int opNum, uint16 &addr);
+
+#endif // #ifndef _TRACE_H_
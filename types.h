@@ -1,76 +1,93 @@
-//----------------------------------------------------------------------------
-//
-// types.h
-//
-//----------------------------------------------------------------------------
-//
-// Copyright (c) 2006, Symantec Corporation All rights reserved.
-//
-// Redistribution and use in source and binary forms, with or without
-// modification, are permitted provided that the following conditions are
-// met:
-//
-// -  Redistributions of source code must retain the above copyright notice,
-// this list of conditions and the following disclaimer. 
-//
-// -  Redistributions in binary form must reproduce the above copyright
-// notice, this list of conditions and the following disclaimer in the
-// documentation and/or other materials provided with the distribution. 
-//
-// - Neither the name of Symantec Corp. nor the names of its contributors
-// may be used to endorse or promote products derived from this software
-// without specific prior written permission. 
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
-// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
-// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
-// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-//
-
-#ifndef _TYPES_H_
-
-#define _TYPES_H_
-
-typedef signed char sint8;
-typedef unsigned char uint8;
-typedef signed short sint16;
-typedef unsigned short uint16;
-typedef signed int sint32;
-typedef unsigned int uint32;
-
-#ifndef WIN32
-
-inline void _strupr(char *s)
-{
-	int i;
-	for (i=0;s[i];i++)
-		if (s[i] >= 'a' && s[i] <= 'z')
-			s[i] -= 32;
-}
-
-#endif // #ifndef WIN32
-
-#define RAND_A 16807
-#define RAND_C 0
-#define RAND_M 2147483647
-
-inline uint32 myrand(uint32 seed = 0)
-{
-	static uint32 lastI;
-
-	if (seed != 0)
-		lastI = seed;
-
-	lastI = (RAND_A*lastI+RAND_C) % RAND_M;
-	return(lastI);
-}
-
-#endif // #ifndef _TYPES_H_
-
+//----------------------------------------------------------------------------
+//
+// types.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer. 
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution. 
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission. 
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef _TYPES_H_
+
+#define _TYPES_H_
+
+typedef signed char sint8;
+typedef unsigned char uint8;
+typedef signed short sint16;
+typedef unsigned short uint16;
+typedef signed int sint32;
+typedef unsigned int uint32;
+#ifdef WIN32
+typedef signed __int64 sint64;
+typedef unsigned __int64 uint64;
+#else
+typedef signed long long sint64;
+typedef unsigned long long uint64;
+#endif // #ifdef WIN32
+
+#ifndef WIN32
+
+inline void _strupr(char *s)
+{
+	int i;
+	for (i=0;s[i];i++)
+		if (s[i] >= 'a' && s[i] <= 'z')
+			s[i] -= 32;
+}
+
+#endif // #ifndef WIN32
+
+#define RAND_A 16807
+#define RAND_C 0
+#define RAND_M 2147483647
+
+// the generator state is per-thread so that parallel trials (see runSweep)
+// each get their own reproducible sequence; checkpoints save and restore it
+// directly
+
+inline uint32 &myrandState(void)
+{
+	static thread_local uint32 lastI;
+	return(lastI);
+}
+
+inline uint32 myrand(uint32 seed = 0)
+{
+	uint32 &lastI = myrandState();
+
+	if (seed != 0)
+		lastI = seed;
+
+	lastI = (RAND_A*lastI+RAND_C) % RAND_M;
+	return(lastI);
+}
+
+#endif // #ifndef _TYPES_H_
+
@@ -0,0 +1,254 @@
+//----------------------------------------------------------------------------
+//
+// verify.cpp
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include "verify.h"
+#include "world.h"
+#include "organism.h"
+#include "disasm.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+static const char *g_engineNames[NUM_ENGINES] =
+{
+	"switch",
+	"hooked",
+	"sleep"
+};
+
+#define MAX_REPORTED_SLOTS		8		// differing DNA slots listed per divergence
+#define FULL_COMPARE_INTERVAL	1024	// ticks between full state comparisons
+
+int findEngine(const std::string &name)
+{
+	for (int i=0;i<NUM_ENGINES;i++)
+		if (name == g_engineNames[i])
+			return(i);
+	return(-1);
+}
+
+const char *getEngineName(int engine)
+{
+	return((engine >= 0 && engine < NUM_ENGINES) ? g_engineNames[engine] : "?");
+}
+
+// a World with its own copy of the (per thread) generator state
+
+struct EngineRun
+{
+	EngineRun()
+	{
+		world = NULL;
+	}
+	~EngineRun()
+	{
+		if (world != NULL)
+			delete world;
+	}
+
+	World		*world;
+	uint32		rngState;
+	bool		alive;
+};
+
+static bool startRun(EngineRun &run, Settings &s, CConsole *cc, OrganismBinary *player, OrganismBinary *drone, int engine)
+{
+	myrand(s.getSeed());		// as myRandomize: every engine builds the same world
+	run.world = new World(&s,cc);
+	run.world->setEngine((uint16)engine);
+	if (run.world->populateWorld(player,drone) == false)
+		return(false);
+	run.world->enableHashing();
+	run.rngState = myrandState();
+	run.alive = true;
+	return(true);
+}
+
+static void stepRun(EngineRun &run)
+{
+	myrandState() = run.rngState;
+	run.alive = run.world->step();
+	run.rngState = myrandState();
+}
+
+// the hashes only see DNA writes made through Organism::storeDNA; now and
+// then compare everything in case an engine wrote around it
+
+static int compareFullState(EngineRun &ref, EngineRun &cand, OrganismState *a, OrganismState *b)
+{
+	for (uint32 i=0;i<ref.world->getNumOrganisms();i++)
+	{
+		ref.world->getOrganism(i)->getState(*a);
+		cand.world->getOrganism(i)->getState(*b);
+		b->ledger = a->ledger;
+		if (memcmp(a,b,sizeof(*a)) != 0)
+			return((int)i);
+	}
+	return(-1);
+}
+
+static void printState(FILE *stream, const char *label, OrganismState &st)
+{
+	fprintf(stream,"  %-10s ip=%u x=%u y=%u energy=%d poked=%u\n",label,st.ip,st.x,st.y,st.energy,st.poked);
+	fprintf(stream,"  %-10s",label);
+	for (uint32 i=0;i<MAX_REGS;i++)
+		fprintf(stream," %04X",st.regs[i]);
+	fprintf(stream,"\n");
+}
+
+static void reportDivergence
+(
+	FILE *stream,
+	EngineRun &ref,
+	EngineRun &cand,
+	int engine,
+	int org,
+	uint16 ip,
+	uint32 tick,
+	uint32 seed
+)
+{
+	fprintf(stream,"Engines diverge at tick %u (seed %u), %s vs %s:\n",tick,seed,
+		getEngineName(ENGINE_SWITCH),getEngineName(engine));
+
+	if (ref.rngState != cand.rngState)
+		fprintf(stream,"  random generator: %u vs %u\n",ref.rngState,cand.rngState);
+	if (ref.world->getScore() != cand.world->getScore())
+		fprintf(stream,"  score: %.0f vs %.0f\n",ref.world->getScore(),cand.world->getScore());
+	if (ref.alive != cand.alive)
+		fprintf(stream,"  organisms alive: %s vs %s\n",ref.alive ? "yes" : "no",cand.alive ? "yes" : "no");
+
+	uint32 foodDiffs = 0;
+	for (uint16 y=0;y<GRID_HEIGHT;y++)
+		for (uint16 x=0;x<GRID_WIDTH;x++)
+			if (ref.world->getFoodID(x,y) != cand.world->getFoodID(x,y))
+				foodDiffs++;
+	if (foodDiffs > 0)
+		fprintf(stream,"  food grid: %u cells differ\n",foodDiffs);
+
+	if (org < 0)
+		return;
+
+	OrganismState *a = new OrganismState, *b = new OrganismState;
+	Organism *refOrg = ref.world->getOrganism(org);
+	char line[DISASM_LINE_SIZE];
+
+	refOrg->getState(*a);
+	cand.world->getOrganism(org)->getState(*b);
+
+	DisAsm d(a->dna,a->regs);
+	d.formatInstruction(line,ip);
+	fprintf(stream,"  organism %c (ID %u, %s) executing %04u: %s\n",
+		refOrg->getDisplayChar(),refOrg->getID(),refOrg->getModuleName().c_str(),ip,line);
+
+	printState(stream,getEngineName(ENGINE_SWITCH),*a);
+	printState(stream,getEngineName(engine),*b);
+
+	uint32 shown = 0, slotDiffs = 0;
+	for (uint32 i=0;i<MAX_DNA;i++)
+		if (a->dna[i] != b->dna[i])
+		{
+			if (shown++ < MAX_REPORTED_SLOTS)
+				fprintf(stream,"  dna[%04u]: %04X vs %04X\n",i,a->dna[i],b->dna[i]);
+			slotDiffs++;
+		}
+	if (slotDiffs > shown)
+		fprintf(stream,"  ...%u DNA slots differ in all\n",slotDiffs);
+
+	delete a;
+	delete b;
+}
+
+bool verifyEngine
+(
+	Settings &s,
+	OrganismBinary *player,
+	OrganismBinary *drone,
+	int engine,
+	FILE *stream,
+	uint32 *divergedAt
+)
+{
+	CConsole cc(true);
+	EngineRun *ref = new EngineRun, *cand = new EngineRun;
+	bool same = startRun(*ref,s,&cc,player,drone,ENGINE_SWITCH) &&
+				startRun(*cand,s,&cc,player,drone,engine);
+
+	if (same == false && stream != NULL)
+		fprintf(stream,"Unable to populate the world (seed %u)\n",s.getSeed());
+
+	uint32 numOrgs = same ? ref->world->getNumOrganisms() : 0;
+	vector<uint16> ips(numOrgs);
+	OrganismState *a = new OrganismState, *b = new OrganismState;
+	memset(a,0,sizeof(*a));			// any padding compares equal
+	memset(b,0,sizeof(*b));
+
+	for (uint32 tick=0;same && tick<s.getMaxIterations() && ref->alive;tick++)
+	{
+		for (uint32 i=0;i<numOrgs;i++)
+			ips[i] = ref->world->getOrganism(i)->getIP();
+
+		stepRun(*ref);
+		stepRun(*cand);
+
+		// organisms run in order, so the first one that differs went wrong
+		// first; the others may only be reacting to it
+		int org = -1;
+		for (uint32 i=0;i<numOrgs && org < 0;i++)
+			if (ref->world->getOrganism(i)->hashState() != cand->world->getOrganism(i)->hashState())
+				org = (int)i;
+		if (org < 0 && tick % FULL_COMPARE_INTERVAL == 0)
+			org = compareFullState(*ref,*cand,a,b);
+
+		if (org >= 0 || ref->rngState != cand->rngState || ref->alive != cand->alive ||
+			ref->world->hashState() != cand->world->hashState())
+		{
+			if (stream != NULL)
+				reportDivergence(stream,*ref,*cand,engine,org,org >= 0 ? ips[org] : 0,tick,s.getSeed());
+			if (divergedAt != NULL)
+				*divergedAt = tick;
+			same = false;
+		}
+	}
+
+	delete a;
+	delete b;
+	delete ref;
+	delete cand;
+	return(same);
+}
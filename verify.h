@@ -0,0 +1,70 @@
+//----------------------------------------------------------------------------
+//
+// verify.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef _VERIFY_H_
+
+#define _VERIFY_H_
+
+#include <stdio.h>
+#include <string>
+
+#include "types.h"
+#include "settings.h"
+
+class OrganismBinary;
+
+// --verify: run a candidate engine beside the reference (ENGINE_SWITCH) in
+// lockstep, comparing a hash of each organism and of the world after every
+// tick.  The first difference is reported with the organism, the
+// instruction it was executing and both states.
+
+int findEngine(const std::string &name);		// ENGINE_xxx, or -1
+const char *getEngineName(int engine);
+
+// one seed from s; false if the engines diverge, with a report on stream
+// (unless it is NULL) and the tick in divergedAt
+bool verifyEngine
+(
+	Settings &s,
+	OrganismBinary *player,
+	OrganismBinary *drone,
+	int engine,
+	FILE *stream,
+	uint32 *divergedAt = NULL
+);
+
+
+#endif // #ifndef _VERIFY_H_
@@ -0,0 +1,465 @@
+//----------------------------------------------------------------------------
+//
+// watch.cpp
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#endif // #ifdef WIN32
+
+#include "watch.h"
+
+#include <cstring>
+#include <cstdio>
+#include <cctype>
+#include <cstdlib>
+
+using namespace std;
+
+#define EXPR_STACK_SIZE		32
+
+enum
+{
+	EXPR_CONST,
+	EXPR_REG,
+	EXPR_IP,
+	EXPR_ENERGY,
+	EXPR_X,
+	EXPR_Y,
+	EXPR_DNA,		// pops a slot number, pushes its contents
+	EXPR_NEG,
+	EXPR_NOT,
+	EXPR_COMPL,
+	EXPR_MUL,
+	EXPR_DIV,
+	EXPR_MOD,
+	EXPR_ADD,
+	EXPR_SUB,
+	EXPR_LT,
+	EXPR_LE,
+	EXPR_GT,
+	EXPR_GE,
+	EXPR_EQ,
+	EXPR_NE,
+	EXPR_AND,
+	EXPR_XOR,
+	EXPR_OR,
+	EXPR_LAND,
+	EXPR_LOR
+};
+
+// binary operators, longest spelling first so "<=" wins over "<"
+
+static const struct
+{
+	const char	*text;
+	uint16		op;
+	int			prec;
+} g_binaryOps[] =
+{
+	{ "||", EXPR_LOR,	1 },
+	{ "&&", EXPR_LAND,	2 },
+	{ "==", EXPR_EQ,	6 },
+	{ "!=", EXPR_NE,	6 },
+	{ "<=", EXPR_LE,	7 },
+	{ ">=", EXPR_GE,	7 },
+	{ "|",	EXPR_OR,	3 },
+	{ "^",	EXPR_XOR,	4 },
+	{ "&",	EXPR_AND,	5 },
+	{ "<",	EXPR_LT,	7 },
+	{ ">",	EXPR_GT,	7 },
+	{ "+",	EXPR_ADD,	8 },
+	{ "-",	EXPR_SUB,	8 },
+	{ "*",	EXPR_MUL,	9 },
+	{ "/",	EXPR_DIV,	9 },
+	{ "%",	EXPR_MOD,	9 }
+};
+
+bool BreakExpr::compile(const std::string &text, std::string &error)
+{
+	m_text = text;
+	m_code.clear();
+	m_error = "";
+	m_depth = m_maxDepth = 0;
+	m_pos = m_text.c_str();
+
+	if (parseBinary(1) == true)
+	{
+		skipSpaces();
+		if (*m_pos != 0)
+			m_error = string("unexpected '") + m_pos + "'";
+		else if (m_maxDepth > EXPR_STACK_SIZE)
+			m_error = "expression is too complex";
+	}
+
+	m_pos = NULL;
+	error = m_error;
+	return(m_error.length() == 0);
+}
+
+void BreakExpr::skipSpaces(void)
+{
+	while (*m_pos == ' ' || *m_pos == '\t')
+		m_pos++;
+}
+
+void BreakExpr::emit(uint16 op, sint32 value)
+{
+	ExprOp eo;
+	eo.op = op;
+	eo.value = value;
+	m_code.push_back(eo);
+
+	// track the evaluation stack depth so eval() never needs to check it
+	if (op <= EXPR_Y)
+	{
+		if (++m_depth > m_maxDepth)
+			m_maxDepth = m_depth;
+	}
+	else if (op > EXPR_COMPL)
+		m_depth--;
+}
+
+bool BreakExpr::peekBinary(uint16 &op, int &prec, int &len)
+{
+	skipSpaces();
+	for (unsigned int i=0;i<sizeof(g_binaryOps)/sizeof(g_binaryOps[0]);i++)
+	{
+		len = strlen(g_binaryOps[i].text);
+		if (strncmp(m_pos,g_binaryOps[i].text,len) == 0)
+		{
+			op = g_binaryOps[i].op;
+			prec = g_binaryOps[i].prec;
+			return(true);
+		}
+	}
+	return(false);
+}
+
+bool BreakExpr::parseBinary(int minPrec)
+{
+	if (parseUnary() == false)
+		return(false);
+
+	for (;;)
+	{
+		uint16 op;
+		int prec, len;
+
+		if (peekBinary(op,prec,len) == false || prec < minPrec)
+			return(true);
+		m_pos += len;
+		if (parseBinary(prec+1) == false)
+			return(false);
+		emit(op);
+	}
+}
+
+bool BreakExpr::parseUnary(void)
+{
+	skipSpaces();
+
+	uint16 op;
+	if (*m_pos == '-')
+		op = EXPR_NEG;
+	else if (*m_pos == '!')
+		op = EXPR_NOT;
+	else if (*m_pos == '~')
+		op = EXPR_COMPL;
+	else
+		return(parsePrimary());
+
+	m_pos++;
+	if (parseUnary() == false)
+		return(false);
+	emit(op);
+	return(true);
+}
+
+bool BreakExpr::parsePrimary(void)
+{
+	skipSpaces();
+
+	if (*m_pos == '(' || *m_pos == '[')
+	{
+		char close = (*m_pos == '(') ? ')' : ']';
+		bool dna = *m_pos == '[';
+
+		m_pos++;
+		if (parseBinary(1) == false)
+			return(false);
+		skipSpaces();
+		if (*m_pos != close)
+		{
+			m_error = string("expected '") + close + "'";
+			return(false);
+		}
+		m_pos++;
+		if (dna)
+			emit(EXPR_DNA);
+		return(true);
+	}
+
+	if (isdigit(*m_pos))
+	{
+		char *end;
+		emit(EXPR_CONST,(sint32)strtol(m_pos,&end,0));
+		m_pos = end;
+		return(true);
+	}
+
+	string ident;
+	while (isalnum(*m_pos))
+		ident += (char)tolower(*m_pos++);
+
+	if (ident == "sp")
+		emit(EXPR_REG,SP_REG);
+	else if (ident == "flags")
+		emit(EXPR_REG,FLAGS_REG);
+	else if (ident == "ip")
+		emit(EXPR_IP);
+	else if (ident == "energy")
+		emit(EXPR_ENERGY);
+	else if (ident == "x")
+		emit(EXPR_X);
+	else if (ident == "y")
+		emit(EXPR_Y);
+	else if (ident == "e")
+		emit(EXPR_CONST,FLAG_EQUAL);
+	else if (ident == "l")
+		emit(EXPR_CONST,FLAG_LESS);
+	else if (ident == "g")
+		emit(EXPR_CONST,FLAG_GREATER);
+	else if (ident == "s")
+		emit(EXPR_CONST,FLAG_SUCCESS);
+	else if (ident.length() > 1 && ident[0] == 'r' && isdigit(ident[1]) &&
+			 atoi(ident.c_str()+1) < FLAGS_REG)
+		emit(EXPR_REG,atoi(ident.c_str()+1));
+	else
+	{
+		if (ident.length() == 0)
+			m_error = *m_pos ? string("unexpected '") + m_pos + "'" : "unexpected end of expression";
+		else
+			m_error = "unknown name '" + ident + "'";
+		return(false);
+	}
+
+	return(true);
+}
+
+sint32 BreakExpr::eval(const WatchState &st) const
+{
+	sint32 stack[EXPR_STACK_SIZE];
+	int sp = 0;
+
+	for (unsigned int i=0;i<m_code.size();i++)
+	{
+		const ExprOp &eo = m_code[i];
+		sint32 b;
+
+		switch (eo.op)
+		{
+			case EXPR_CONST:	stack[sp++] = eo.value; continue;
+			case EXPR_REG:		stack[sp++] = st.regs[eo.value]; continue;
+			case EXPR_IP:		stack[sp++] = st.ip; continue;
+			case EXPR_ENERGY:	stack[sp++] = st.energy; continue;
+			case EXPR_X:		stack[sp++] = st.x; continue;
+			case EXPR_Y:		stack[sp++] = st.y; continue;
+			case EXPR_DNA:
+				stack[sp-1] = ((uint32)stack[sp-1] < MAX_DNA) ? st.dna[stack[sp-1]] : 0;
+				continue;
+			case EXPR_NEG:		stack[sp-1] = -stack[sp-1]; continue;
+			case EXPR_NOT:		stack[sp-1] = !stack[sp-1]; continue;
+			case EXPR_COMPL:	stack[sp-1] = ~stack[sp-1]; continue;
+		}
+
+		// binary operator
+		b = stack[--sp];
+		sint32 &a = stack[sp-1];
+
+		switch (eo.op)
+		{
+			case EXPR_MUL:	a = a * b; break;
+			case EXPR_DIV:	a = b ? a / b : 0; break;
+			case EXPR_MOD:	a = b ? a % b : 0; break;
+			case EXPR_ADD:	a = a + b; break;
+			case EXPR_SUB:	a = a - b; break;
+			case EXPR_LT:	a = a < b; break;
+			case EXPR_LE:	a = a <= b; break;
+			case EXPR_GT:	a = a > b; break;
+			case EXPR_GE:	a = a >= b; break;
+			case EXPR_EQ:	a = a == b; break;
+			case EXPR_NE:	a = a != b; break;
+			case EXPR_AND:	a = a & b; break;
+			case EXPR_XOR:	a = a ^ b; break;
+			case EXPR_OR:	a = a | b; break;
+			case EXPR_LAND:	a = a && b; break;
+			case EXPR_LOR:	a = a || b; break;
+		}
+	}
+
+	return(sp ? stack[0] : 0);
+}
+
+Watchpoints::Watchpoints()
+{
+	clear();
+}
+
+void Watchpoints::clear(void)
+{
+	memset(m_dnaBits,0,sizeof(m_dnaBits));
+	m_regMask = 0;
+	m_stopOnPoke = false;
+	m_breaks.clear();
+	m_lastResult.clear();
+	m_hit = false;
+	m_reason = "";
+}
+
+void Watchpoints::watchDNA(uint16 first, uint16 last)
+{
+	for (uint32 i=first;i<=last && i<MAX_DNA;i++)
+		m_dnaBits[i >> 5] |= 1u << (i & 31);
+}
+
+void Watchpoints::watchRegister(uint16 reg, uint16 curValue)
+{
+	if (reg < MAX_REGS)
+	{
+		m_regMask |= 1 << reg;
+		m_regSnapshot[reg] = curValue;
+	}
+}
+
+bool Watchpoints::addBreak(const std::string &text, const WatchState &st, std::string &error)
+{
+	BreakExpr be;
+
+	if (be.compile(text,error) == false)
+		return(false);
+
+	m_breaks.push_back(be);
+	m_lastResult.push_back(be.eval(st) != 0);	// must become true to stop
+	return(true);
+}
+
+void Watchpoints::dnaHit(uint16 slot, uint16 oldValue, uint16 newValue, bool poked)
+{
+	char temp[256];
+
+	sprintf(temp,"%s[%d] changed %d -> %d",poked ? "poked: " : "",slot,oldValue,newValue);
+	m_reason = temp;
+	m_hit = true;
+}
+
+bool Watchpoints::triggered(const WatchState &st)
+{
+	bool stop = m_hit;
+	char temp[256];
+
+	m_hit = false;
+
+	if (m_regMask != 0)
+	{
+		for (uint16 i=0;i<MAX_REGS;i++)
+		{
+			if ((m_regMask & (1 << i)) && st.regs[i] != m_regSnapshot[i])
+			{
+				if (!stop)
+				{
+					sprintf(temp,"R%02d changed %d -> %d",i,m_regSnapshot[i],st.regs[i]);
+					m_reason = temp;
+					stop = true;
+				}
+				m_regSnapshot[i] = st.regs[i];
+			}
+		}
+	}
+
+	for (unsigned int i=0;i<m_breaks.size();i++)
+	{
+		bool result = m_breaks[i].eval(st) != 0;
+		if (result && !m_lastResult[i] && !stop)
+		{
+			m_reason = "break: " + m_breaks[i].getString();
+			stop = true;
+		}
+		m_lastResult[i] = result;
+	}
+
+	return(stop);
+}
+
+void Watchpoints::getList(std::vector<std::string> &lines) const
+{
+	char temp[256];
+	uint32 i;
+
+	lines.clear();
+
+	// coalesce the DNA bitmap into ranges
+	for (i=0;i<MAX_DNA;i++)
+	{
+		if ((m_dnaBits[i >> 5] & (1u << (i & 31))) == 0)
+			continue;
+		uint32 first = i;
+		while (i+1 < MAX_DNA && (m_dnaBits[(i+1) >> 5] & (1u << ((i+1) & 31))))
+			i++;
+		if (first == i)
+			sprintf(temp,"watch [%d]",first);
+		else
+			sprintf(temp,"watch [%d-%d]",first,i);
+		lines.push_back(temp);
+	}
+
+	for (i=0;i<MAX_REGS;i++)
+	{
+		if (m_regMask & (1 << i))
+		{
+			sprintf(temp,"watch R%02d",i);
+			lines.push_back(temp);
+		}
+	}
+
+	if (m_stopOnPoke)
+		lines.push_back("watch poke");
+
+	for (i=0;i<m_breaks.size();i++)
+		lines.push_back("break " + m_breaks[i].getString());
+
+	if (lines.size() == 0)
+		lines.push_back("no watchpoints or breakpoints");
+}
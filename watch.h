@@ -0,0 +1,143 @@
+//----------------------------------------------------------------------------
+//
+// watch.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef _WATCH_H_
+
+#define _WATCH_H_
+
+#include <string>
+#include <vector>
+
+#include "types.h"
+#include "constants.h"
+
+// the parts of an organism that breakpoint expressions can look at
+
+struct WatchState
+{
+	uint16	*regs;
+	uint16	*dna;
+	uint16	ip;
+	sint32	energy;
+	uint16	x, y;
+};
+
+// a breakpoint expression such as "r3 > 100 && flags&s", compiled once into
+// postfix code.  Operands: r0-r13, sp, flags, ip, energy, x, y, [expr] for a
+// DNA slot, numbers, and the flag bits e, l, g and s.  Operators and their
+// precedence follow C.
+
+class BreakExpr
+{
+public:
+	bool compile(const std::string &text, std::string &error);
+	sint32 eval(const WatchState &st) const;
+	std::string getString(void) const
+	{
+		return(m_text);
+	}
+
+private:
+	struct ExprOp
+	{
+		uint16	op;
+		sint32	value;
+	};
+
+	bool parseBinary(int minPrec);
+	bool parseUnary(void);
+	bool parsePrimary(void);
+	bool peekBinary(uint16 &op, int &prec, int &len);
+	void skipSpaces(void);
+	void emit(uint16 op, sint32 value = 0);
+
+private:
+	std::string				m_text;
+	std::vector<ExprOp>		m_code;
+	const char				*m_pos;		// parse position
+	std::string				m_error;
+	int						m_depth, m_maxDepth;
+};
+
+// debugger stop conditions for one organism.  DNA watches are a bitmap that
+// the organism's DNA write paths test; register watches and expressions are
+// predicates checked once per instruction while the debugger runs free.
+
+class Watchpoints
+{
+public:
+	Watchpoints();
+
+	void watchDNA(uint16 first, uint16 last);
+	void watchRegister(uint16 reg, uint16 curValue);
+	void watchPokes(void)
+	{
+		m_stopOnPoke = true;
+	}
+	bool addBreak(const std::string &text, const WatchState &st, std::string &error);
+	void clear(void);
+
+	// called from every DNA store of the organism
+	void onWrite(uint16 slot, uint16 oldValue, uint16 newValue, bool poked)
+	{
+		if ((m_dnaBits[slot >> 5] & (1u << (slot & 31))) && oldValue != newValue)
+			dnaHit(slot,oldValue,newValue,poked);
+		else if (poked && m_stopOnPoke)
+			dnaHit(slot,oldValue,newValue,poked);
+	}
+
+	bool triggered(const WatchState &st);
+	std::string getReason(void) const
+	{
+		return(m_reason);
+	}
+	void getList(std::vector<std::string> &lines) const;
+
+private:
+	void dnaHit(uint16 slot, uint16 oldValue, uint16 newValue, bool poked);
+
+private:
+	uint32					m_dnaBits[(MAX_DNA+31)/32];
+	uint16					m_regMask;
+	uint16					m_regSnapshot[MAX_REGS];
+	bool					m_stopOnPoke;
+	std::vector<BreakExpr>	m_breaks;
+	std::vector<bool>		m_lastResult;	// expressions stop on false -> true
+	bool					m_hit;
+	std::string				m_reason;
+};
+
+#endif // #ifndef _WATCH_H_
@@ -1,412 +1,1154 @@
-//----------------------------------------------------------------------------
-//
-// world.cpp
-//
-//----------------------------------------------------------------------------
-//
-// Copyright (c) 2006, Symantec Corporation All rights reserved.
-//
-// Redistribution and use in source and binary forms, with or without
-// modification, are permitted provided that the following conditions are
-// met:
-//
-// -  Redistributions of source code must retain the above copyright notice,
-// this list of conditions and the following disclaimer. 
-//
-// -  Redistributions in binary form must reproduce the above copyright
-// notice, this list of conditions and the following disclaimer in the
-// documentation and/or other materials provided with the distribution. 
-//
-// - Neither the name of Symantec Corp. nor the names of its contributors
-// may be used to endorse or promote products derived from this software
-// without specific prior written permission. 
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
-// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
-// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
-// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-//
-
-#ifdef WIN32
-#pragma warning(disable:4786)
-#endif // #ifdef WIN32
-
-#include "world.h"
-#include "organism.h"
-
-#include <ctime>
-
-using namespace std;
-
-World::World(Settings *settings, CConsole *console)
-{
-	m_console = console;
-	m_settings = settings;
-	m_maxFoodID = (uint16)(myrand() % MAX_FOOD_ID);
-	if (m_maxFoodID <= MIN_FOOD_ID)
-		m_maxFoodID = MIN_FOOD_ID;
-	m_score = 0;	
-	m_curIteration = 0;
-	m_maxIterations = settings->getMaxIterations();
-	m_terminate = false;
-	m_redrawAll = true;
-	m_quiet = settings->getQuiet();
-
-	uint32 i,j , foodDensity = settings->getFoodDensity();
-
-	// zero grid
-
-	for (i=0;i<GRID_HEIGHT;i++)
-		for (j=0;j<GRID_WIDTH;j++)
-			m_foodGrid[i][j] = 0;		// no food or collection point
-		
-	// disperse collection points
-
-	for (i=0;i<MAX_COLLECTION_POINTS;i++)
-	{
-		int x,y;
-
-		do
-		{
-			x = myrand() % GRID_WIDTH;
-			y = myrand() % GRID_HEIGHT;
-		}
-		while (m_foodGrid[y][x] != 0);
-
-		m_foodGrid[y][x] = COLLECTION_POINT_ID;
-	}
-
-	// disperse food
-
-	for (i=0;i<GRID_HEIGHT;i++)
-		for (j=0;j<GRID_WIDTH;j++)
-		{
-			if ((uint32)(myrand() % 100) < foodDensity && m_foodGrid[i][j] == 0)
-				m_foodGrid[i][j] = (uint16)((myrand() % m_maxFoodID) + 1);
-		}
-
-	// determine which food is poison
-
-	for (i=0;i<MAX_FOOD_ID;i++)
-		m_poisoned[i] = false;
-
-	uint32 foodToPoison = (m_maxFoodID * PERCENT_POISONED_FOOD) / 100;
-
-	while (foodToPoison > 0)
-	{
-		i = myrand() % m_maxFoodID;		
-		if (m_poisoned[i] == false)
-		{
-			m_poisoned[i] = true;
-			--foodToPoison;
-		}
-	}
-
-	// stream
-
-	if (m_settings->getDebug().length() > 0)
-		m_debugStream = fopen(m_settings->getDebug().c_str(),"wt");
-	else
-		m_debugStream = NULL;
-}
-
-World::~World()
-{
-	for (uint32 i=0;i<m_orgs.size();i++)
-		delete m_orgs[i];
-}
-
-Organism *World::occupied(uint16 x, uint16 y)
-{
-	for (uint32 i=0;i<m_orgs.size();i++)
-		if (m_orgs[i]->getX() == x && m_orgs[i]->getY() == y)
-			return(m_orgs[i]);
-
-	return(NULL);
-}
-
-uint16 World::getFoodID(uint16 x, uint16 y)
-{
-	if (x >= GRID_WIDTH || y >= GRID_HEIGHT)
-		return(0);
-	return(m_foodGrid[y][x]);
-}
-
-bool World::eatFood(Organism *me, uint16 x, uint16 y)	// returns true if food was eaten
-{
-	uint16 id = getFoodID(x,y);
-	if (id == 0 || id == COLLECTION_POINT_ID)
-		return(false);			// no food to eat
-
-	if (m_poisoned[m_foodGrid[y][x]])
-	{
-		me->mutate();
-	}
-
-	uint16 ateFoodID = m_foodGrid[y][x];
-
-	m_foodGrid[y][x] = 0;		// remove the food
-
-	// place new food of the same ID somewhere else
-
-	for(;;)
-	{
-		x = (uint16)(myrand() % GRID_WIDTH);
-		y = (uint16)(myrand() % GRID_HEIGHT);
-		if (m_foodGrid[y][x] == 0)
-		{
-			m_foodGrid[y][x] = ateFoodID;
-			break;
-		}
-	}
-
-	m_foodCoords.push_back(Coord(x,y));
-	
-	return(true);				// ate the food
-}
-
-bool World::addNewOrganism(uint16 newX,uint16 newY,Organism *newOrg)
-{
-	if (newOrg == NULL)
-		return(false);
-
-	for (uint32 i=0;i<m_orgs.size();i++)
-		if (m_orgs[i]->getX() == newX && m_orgs[i]->getY() == newY)
-			return(false);		// space is full
-
-	if (newOrg->setXY(newX,newY) == false)
-		return(false);
-
-	m_orgs.push_back(newOrg);
-	return(true);
-}
-
-
-bool World::tick(void)
-{
-	int alive = 0;
-
-	for (uint32 i=0;i<m_orgs.size();i++)
-	{
-		if (m_orgs[i]->alive())
-		{
-			m_orgs[i]->execInstr();
-			++alive;
-		}
-	}
-
-	return(alive != 0);
-}
-
-void World::run(void)
-{
-	m_console->clearScreen();
-	showDisplay();
-
-	for (m_curIteration=0;m_curIteration<m_maxIterations && !m_terminate;m_curIteration++)
-	{
-		if (tick() == false)
-			break;
-		showDisplay();
-	}
-}
-
-
-bool World::generatePower(Organism *me, uint16 energyToRelease)
-{
-	if (m_foodGrid[me->getY()][me->getX()] == COLLECTION_POINT_ID)
-	{
-		m_score += (double)energyToRelease;
-		return(true);
-	}
-
-	return(false);
-}
-
-void World::terminate(void)
-{
-	m_terminate = true;
-}
-
-
-bool World::populateWorld
-(
-	 OrganismBinary *player,
-	 OrganismBinary *drone
-)
-{
-	uint16 numOrganisms = m_settings->getMaxOrganisms();
-	uint16 i,x,y;
-	uint16 arr[MAX_DNA];
-
-	player->getProgram(arr);
-
-	for (i=0;i<numOrganisms;i++)
-	{
-		Organism *org  = new Organism(	this, 
-										arr, 
-										player->getProgramSize(),
-										START_ENERGY, 
-										i,
-										m_settings->getSingleStep() && 
-											i == m_settings->getSingleStepID(),
-										player->getModuleInfo(), 
-										m_debugStream, 
-										false,
-										m_console);
-		if (org == NULL)
-			return(false);
-
-		do
-		{
-			x = (uint16)(myrand() % GRID_WIDTH);
-			y = (uint16)(myrand() % GRID_HEIGHT);
-		} while (addNewOrganism(x,y,org) == false);
-	}
-
-
-	uint16 numDrones = m_settings->getMaxDrones();
-
-	drone->getProgram(arr);
-
-	for (i=0;i<numDrones;i++)
-	{
-		Organism *org  = new Organism(	this, 
-										arr, 
-										drone->getProgramSize(),
-										START_ENERGY, 
-										i+numOrganisms,
-										false,
-										DRONE_STRING, 
-										NULL, 
-										true,
-										m_console);
-		if (org == NULL)
-			return(false);
-
-		do
-		{
-			x = (uint16)(myrand() % GRID_WIDTH);
-			y = (uint16)(myrand() % GRID_HEIGHT);
-		} while (addNewOrganism(x,y,org) == false);
-	}
-
-	return(true);
-}
-
-void World::showDisplay(void)
-{
-	if (m_quiet == true)
-		return;
-
-	char temp[256];
-
-	if (m_curIteration % 100 == 0 || m_settings->getSingleStep() || m_redrawAll == true)
-	{
-		sprintf(temp,"Score: %.0lf, Ticks: %d of %d   (Seed=%u)",m_score,m_curIteration,m_maxIterations,m_settings->getSeed());
-		m_console->gotoXY(SCORE_X,SCORE_Y);
-		m_console->printString(temp);
-	}
-
-	if (m_redrawAll)
-	{
-		m_redrawAll = false;
-
-		for (int i=0;i<GRID_HEIGHT;i++)
-		{
-			for (int j=0;j<GRID_WIDTH;j++)
-			{
-				m_console->gotoXY(START_X+j,START_Y+i);
-				if (m_foodGrid[i][j] == COLLECTION_POINT_ID)
-					m_console->printChar('$');
-				else if (m_foodGrid[i][j] > 0)
-					m_console->printChar('*');
-				else
-					m_console->printChar(' ');
-			}
-		}
-
-		unsigned int size = m_orgs.size();
-
-		for (unsigned int k=0;k<size;k++)
-		{
-			m_console->gotoXY(START_X + m_orgs[k]->getX(),
-							  START_Y + m_orgs[k]->getY());
-			m_console->printChar(m_orgs[k]->getDisplayChar());
-		}
-	}
-	else
-	{	
-		// print all new food out first!
-
-		if (m_foodCoords.size())
-		{
-			for (size_t i=0;i<m_foodCoords.size();i++)
-			{
-				if (m_foodGrid[m_foodCoords[i].y][m_foodCoords[i].x] != 0)
-				{
-					m_console->gotoXY(START_X+m_foodCoords[i].x,START_Y+m_foodCoords[i].y);
-					m_console->printChar('*');
-				}
-			}
-
-			m_foodCoords.clear();
-		}
-
-		unsigned int size = m_orgs.size();
-		unsigned int k;
-		bool needToRedraw = false;
-
-		for (k=0;k<size;k++)
-		{
-			uint16 oldX, oldY;
-			
-			if (m_orgs[k]->getOldXY(&oldX,&oldY) == true)
-			{
-				m_console->gotoXY(START_X+oldX,START_Y+oldY);
-				if (m_foodGrid[oldY][oldX] == COLLECTION_POINT_ID)
-					m_console->printChar('$');
-				else if (m_foodGrid[oldY][oldX] > 0)
-					m_console->printChar('*');
-				else
-					m_console->printChar(' ');
-
-				needToRedraw = true;
-			}
-		}
-
-		if (needToRedraw)
-		{
-			for (k=0;k<size;k++)
-			{
-				m_console->gotoXY(START_X + m_orgs[k]->getX(),
-								  START_Y + m_orgs[k]->getY());
-				m_console->printChar(m_orgs[k]->getDisplayChar());
-			}
-		}
-	}
-
-	m_console->refresh();
-}
-
-
-void World::getNumAlive(uint16 *orgs, uint16 *drones)
-{
-	*orgs = *drones = 0;
-
-	for (uint32 i=0;i<m_orgs.size();i++)
-		if (m_orgs[i]->alive())
-		{
-			if (m_orgs[i]->getModuleName() == "drone")
-				++(*drones);
-			else 
-				++(*orgs);
-		}
-}
+//----------------------------------------------------------------------------
+//
+// world.cpp
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer. 
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution. 
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission. 
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifdef WIN32
+#pragma warning(disable:4786)
+#endif // #ifdef WIN32
+
+#include "world.h"
+#include "organism.h"
+#include "mappedfile.h"
+
+#include <ctime>
+#include <cstdlib>
+#include <cmath>
+#include <cstring>
+
+using namespace std;
+
+// state as of the start of a tick.  m_maxFoodID and m_poisoned never change
+// after construction so they are not part of it.
+
+struct WorldCheckpoint
+{
+	uint32					tick;
+	uint32					rngState;
+	double					score;
+	uint16					foodGrid[GRID_HEIGHT][GRID_WIDTH];
+	vector<OrganismState>	orgs;
+};
+
+// --save-at/--resume file: this header, then one OrganismState per organism
+// in m_orgs order.  Fields are laid out so the structure has no interior
+// padding and the records that follow stay aligned when the file is mapped.
+
+struct SnapshotHeader
+{
+	char	magic[8];			// SNAPSHOT_MAGIC
+	uint32	version;			// SNAPSHOT_VERSION
+	uint32	headerSize;			// sizeof(SnapshotHeader)
+	uint32	orgStateSize;		// sizeof(OrganismState)
+	uint32	tick;
+	uint32	rngState;
+	uint32	seed;
+	double	score;
+	uint16	maxFoodID;
+	uint16	numOrgs;
+	uint16	gridWidth;
+	uint16	gridHeight;
+	uint8	poisoned[MAX_FOOD_ID+1];
+	uint8	reserved;
+	uint16	foodGrid[GRID_HEIGHT][GRID_WIDTH];
+};
+
+World::World(Settings *settings, CConsole *console)
+{
+	m_console = console;
+	m_settings = settings;
+	m_maxFoodID = (uint16)(myrand() % MAX_FOOD_ID);
+	if (m_maxFoodID <= MIN_FOOD_ID)
+		m_maxFoodID = MIN_FOOD_ID;
+	m_score = 0;	
+	m_curIteration = 0;
+	m_maxIterations = settings->getMaxIterations();
+	m_terminate = false;
+	m_redrawAll = true;
+	memset(m_dirty,0,sizeof(m_dirty));
+	memset(m_shown,' ',sizeof(m_shown));
+	m_quiet = settings->getQuiet() || settings->getAttachDeferred();
+	m_attachTarget = NULL;
+	m_reversible = settings->getSingleStep();
+	m_checkpointInterval = CHECKPOINT_INTERVAL;
+	m_nextCheckpoint = 0;
+	m_rewindTo = INVALID_TICK;
+	m_phases = settings->getPhases() ? new PhaseProfile : NULL;
+	m_perf = NULL;
+	m_engine = settings->getSleep() ? ENGINE_SLEEP : ENGINE_SWITCH;
+	m_frameTicks = settings->getSingleStep() ? 1 : settings->getFrameTicks();
+	m_frameNs = (settings->getSingleStep() || settings->getFPS() == 0) ? 0 : 1000000000ULL / settings->getFPS();
+	m_nextFrame = 0;
+	m_engineProfile = NULL;
+	m_turn = 0;
+	m_turnTick = INVALID_TICK;
+	m_hashing = false;
+	m_foodHash = 0;
+	m_instructions = 0;
+	m_runTicks = 0;
+	m_alive = 0;
+	m_findCycles = false;
+	m_markTick = INVALID_TICK;
+	m_markHash = 0;
+	m_markRng = 0;
+	m_markAlive = 0;
+	m_markSpan = 1;
+	m_cycleStart = NULL;
+	m_cycleEnd = 0;
+	m_cyclePeriod = 0;
+	m_cycleInstructions = 0;
+	m_cyclesFound = 0;
+	m_skippedTicks = 0;
+	m_lastCycleTick = 0;
+	if (settings->getPerf())
+	{
+		std::string error;
+		m_perf = new PerfCounters;
+		if (m_perf->open(error) == false)
+		{
+			delete m_perf;
+			m_perf = NULL;
+			m_error = "--perf: " + error;
+		}
+	}
+
+	uint32 i,j , foodDensity = settings->getFoodDensity();
+
+	// zero grid
+
+	for (i=0;i<GRID_HEIGHT;i++)
+		for (j=0;j<GRID_WIDTH;j++)
+			m_foodGrid[i][j] = 0;		// no food or collection point
+		
+	// disperse collection points
+
+	for (i=0;i<MAX_COLLECTION_POINTS;i++)
+	{
+		int x,y;
+
+		do
+		{
+			x = myrand() % GRID_WIDTH;
+			y = myrand() % GRID_HEIGHT;
+		}
+		while (m_foodGrid[y][x] != 0);
+
+		m_foodGrid[y][x] = COLLECTION_POINT_ID;
+	}
+
+	// disperse food
+
+	for (i=0;i<GRID_HEIGHT;i++)
+		for (j=0;j<GRID_WIDTH;j++)
+		{
+			if ((uint32)(myrand() % 100) < foodDensity && m_foodGrid[i][j] == 0)
+				m_foodGrid[i][j] = (uint16)((myrand() % m_maxFoodID) + 1);
+		}
+
+	// determine which food is poison
+
+	for (i=0;i<MAX_FOOD_ID;i++)
+		m_poisoned[i] = false;
+
+	uint32 foodToPoison = (m_maxFoodID * PERCENT_POISONED_FOOD) / 100;
+
+	while (foodToPoison > 0)
+	{
+		i = myrand() % m_maxFoodID;		
+		if (m_poisoned[i] == false)
+		{
+			m_poisoned[i] = true;
+			--foodToPoison;
+		}
+	}
+
+	// trace
+
+	m_trace = NULL;
+	m_profile = NULL;
+	if (m_settings->getDebug().length() > 0)
+	{
+		m_trace = new TraceWriter;
+		if (m_trace->open(m_settings->getDebug(),m_settings->getTraceDrop(),m_error) == false)
+		{
+			delete m_trace;
+			m_trace = NULL;
+		}
+		else
+			m_trace->setFilter(m_settings->getTraceFirstTick(),m_settings->getTraceLastTick(),
+							   m_settings->getTraceFirstIP(),m_settings->getTraceLastIP(),
+							   m_settings->getTraceClasses());
+	}
+}
+
+World::~World()
+{
+	for (uint32 i=0;i<m_orgs.size();i++)
+		delete m_orgs[i];
+	for (uint32 i=0;i<m_checkpoints.size();i++)
+		delete m_checkpoints[i];
+	if (m_trace != NULL)
+		delete m_trace;
+	if (m_phases != NULL)
+		delete m_phases;
+	if (m_perf != NULL)
+		delete m_perf;
+	if (m_engineProfile != NULL)
+		delete m_engineProfile;
+	if (m_cycleStart != NULL)
+		delete m_cycleStart;
+}
+
+uint32 World::getTraceDropped(void)
+{
+	return(m_trace != NULL ? m_trace->getDropped() : 0);
+}
+
+Organism *World::occupied(uint16 x, uint16 y)
+{
+	bool timed = m_phases != NULL && m_phases->sample(PHASE_OCCUPIED);
+	uint64 start = timed ? PhaseProfile::now() : 0;
+	uint32 i;
+
+	for (i=0;i<m_orgs.size();i++)
+		if (m_orgs[i]->getX() == x && m_orgs[i]->getY() == y)
+			break;
+
+	Organism *org = (i < m_orgs.size()) ? m_orgs[i] : NULL;
+	if (m_phases != NULL)
+	{
+		m_phases->addItems(PHASE_OCCUPIED,(org != NULL) ? i+1 : i);
+		if (timed)
+			m_phases->addSample(PHASE_OCCUPIED,start);
+	}
+	return(org);
+}
+
+uint16 World::getFoodID(uint16 x, uint16 y)
+{
+	if (x >= GRID_WIDTH || y >= GRID_HEIGHT)
+		return(0);
+	return(m_foodGrid[y][x]);
+}
+
+bool World::eatFood(Organism *me, uint16 x, uint16 y)	// returns true if food was eaten
+{
+	uint16 id = getFoodID(x,y);
+	if (id == 0 || id == COLLECTION_POINT_ID)
+		return(false);			// no food to eat
+
+	if (m_poisoned[m_foodGrid[y][x]])
+	{
+		me->onPoisoned();
+	}
+
+	uint16 ateFoodID = m_foodGrid[y][x];
+
+	m_foodGrid[y][x] = 0;		// remove the food
+	markCell(x,y);
+	if (m_hashing)
+		m_foodHash ^= hashKey(y*GRID_WIDTH+x,ateFoodID) ^ hashKey(y*GRID_WIDTH+x,0);
+
+	// place new food of the same ID somewhere else
+
+	uint64 start = (m_phases != NULL) ? PhaseProfile::now() : 0;
+	uint32 tries = 0;
+
+	for(;;)
+	{
+		tries++;
+		x = (uint16)(myrand() % GRID_WIDTH);
+		y = (uint16)(myrand() % GRID_HEIGHT);
+		if (m_foodGrid[y][x] == 0)
+		{
+			m_foodGrid[y][x] = ateFoodID;
+			break;
+		}
+	}
+	if (m_hashing)
+		m_foodHash ^= hashKey(y*GRID_WIDTH+x,0) ^ hashKey(y*GRID_WIDTH+x,ateFoodID);
+
+	if (m_phases != NULL)
+		m_phases->add(PHASE_FOOD,start,tries);
+
+	markCell(x,y);
+	
+	return(true);				// ate the food
+}
+
+bool World::addNewOrganism(uint16 newX,uint16 newY,Organism *newOrg)
+{
+	if (newOrg == NULL)
+		return(false);
+
+	for (uint32 i=0;i<m_orgs.size();i++)
+		if (m_orgs[i]->getX() == newX && m_orgs[i]->getY() == newY)
+			return(false);		// space is full
+
+	if (newOrg->setXY(newX,newY) == false)
+		return(false);
+
+	m_orgs.push_back(newOrg);
+	return(true);
+}
+
+
+bool World::tick(void)
+{
+	bool timed = m_phases != NULL && m_phases->sample(PHASE_TICK);
+	uint64 start = timed ? PhaseProfile::now() : 0;
+	int alive = 0;
+
+	if (m_engine == ENGINE_SLEEP)
+		alive = tickSleeping();
+	else
+	{
+		for (uint32 i=0;i<m_orgs.size();i++)
+		{
+			if (m_orgs[i]->alive())
+			{
+				m_orgs[i]->execInstr();
+				++alive;
+			}
+		}
+	}
+
+	m_instructions += alive;
+	m_alive = alive;
+	if (m_phases != NULL)
+	{
+		m_phases->addItems(PHASE_TICK,alive);
+		if (timed)
+			m_phases->addSample(PHASE_TICK,start);
+	}
+	return(alive != 0);
+}
+
+// ENGINE_SLEEP: an organism asleep in an idle loop still counts as alive
+// and running, but skips its turns until something wakes it or it is down
+// to its last unit of energy; it then runs that last instruction itself, so
+// it dies on the exact tick it would have
+
+uint32 World::tickSleeping(void)
+{
+	uint32 alive = 0;
+
+	m_turnTick = m_curIteration;
+	for (m_turn=0;m_turn<m_orgs.size();m_turn++)
+	{
+		Organism *org = m_orgs[m_turn];
+		if (org->alive() == false)
+			continue;
+		++alive;
+		if (org->isAsleep())
+		{
+			if (m_curIteration < org->getWakeTick())
+				continue;
+			org->wake();
+		}
+		else if (org->trySleep(m_curIteration))
+			continue;
+		org->execInstr();
+	}
+	return(alive);
+}
+
+// one tick and nothing else: no display, snapshots or debugger (--verify)
+
+bool World::step(void)
+{
+	bool alive = tick();
+	m_curIteration++;
+	return(alive);
+}
+
+void World::enableHashing(void)
+{
+	m_hashing = true;
+	m_foodHash = 0;
+	for (uint32 i=0;i<GRID_HEIGHT;i++)
+		for (uint32 j=0;j<GRID_WIDTH;j++)
+			m_foodHash ^= hashKey(i*GRID_WIDTH+j,m_foodGrid[i][j]);
+	for (uint32 i=0;i<m_orgs.size();i++)
+		m_orgs[i]->setHashing(true);
+}
+
+// the world outside its organisms; the RNG is the caller's (it is per thread)
+
+uint64 World::hashState(void)
+{
+	uint64 score;
+	memcpy(&score,&m_score,sizeof(score));
+	return(hashMix(hashMix(m_foodHash,score),m_curIteration));
+}
+
+void World::run(void)
+{
+	m_console->clearScreen();
+	showDisplay();
+
+	if (m_attachTarget != NULL)
+	{
+		m_console->gotoXY(SCORE_X,SCORE_Y);
+		m_console->printString("Running until the debug condition is met...");
+	}
+
+	// skipping ticks would leave gaps in a trace, a profile or the
+	// debugger's history
+	m_findCycles = m_settings->getCycles() && m_trace == NULL && m_profile == NULL &&
+		m_engine != ENGINE_HOOKED && m_attachTarget == NULL && m_reversible == false &&
+		m_settings->getSaveAtTick() == INVALID_TICK;
+	if (m_findCycles && m_hashing == false)
+		enableHashing();
+
+	uint64 start = (m_phases != NULL) ? PhaseProfile::now() : 0;
+	uint32 firstTick = m_curIteration;
+	if (m_perf != NULL)
+		m_perf->start();
+
+	// starts at 0, or at the tick of a --resume snapshot
+	for (;m_curIteration<m_maxIterations && !m_terminate;m_curIteration++)
+	{
+		if (m_curIteration == m_settings->getSaveAtTick() &&
+			saveSnapshot(m_settings->getSnapshotFile(),m_error) == false)
+			m_error = "Error saving snapshot:\n " + m_error;
+
+		// deferred -g: one check per tick; the organism itself runs hook-free
+		if (m_attachTarget != NULL && attachConditionMet())
+			attachDebugger();
+		if (m_reversible)
+			updateCheckpoints();
+
+		if (tick() == false)
+			break;
+		if (frameDue())
+		{
+			if (m_phases != NULL && m_phases->sample(PHASE_DISPLAY))
+			{
+				uint64 shown = PhaseProfile::now();
+				showDisplay();
+				m_phases->addSample(PHASE_DISPLAY,shown);
+			}
+			else
+				showDisplay();
+		}
+
+		if (m_findCycles)
+			findCycle();
+
+		// the debugger asked to go back; the loop increment brings us to
+		// the checkpoint's tick (unsigned wrap-around when that is tick 0)
+		if (m_rewindTo != INVALID_TICK)
+			m_curIteration = restoreCheckpoint() - 1;
+	}
+
+	if (m_perf != NULL)
+		m_perf->stop();
+	if (m_phases != NULL)
+		m_phases->add(PHASE_RUN,start);
+	m_runTicks = m_curIteration - firstTick;
+
+	if (m_frameTicks != 1 || m_frameNs != 0)
+		showDisplay();				// the last frame shows how it ended
+
+	// the ledgers and final energies are read from here on
+	for (uint32 i=0;i<m_orgs.size();i++)
+		m_orgs[i]->wake();
+}
+
+// --cycles.  Once no one eats or calls rand the RNG stands still, and the
+// world can come back to an earlier state in everything but the organisms'
+// energy, which every instruction spends.  Brent's method finds the repeat:
+// each tick's hash is compared with a mark that moves on after 1, 2, 4...
+// ticks, and starts over whenever the RNG moves or an organism dies.  A match
+// is then replayed for one more period from a full checkpoint, watching
+// every outcome that depended on energy, and skipped ahead by as many
+// periods as leave all of those outcomes (and every organism's life) the
+// same.  What is left runs normally, so deaths fall on their exact tick.
+
+uint64 World::hashCycleState(void)
+{
+	uint64 h = hashWord(m_foodHash,myrandState());
+
+	for (uint32 i=0;i<m_orgs.size();i++)
+		h = hashWord(h,m_orgs[i]->hashState(false));
+	return(hashMix(0,h));
+}
+
+void World::findCycle(void)
+{
+	uint32 now = m_curIteration+1;
+
+	if (m_cycleStart != NULL)
+	{
+		for (uint32 i=0;i<m_orgs.size();i++)
+			if (m_orgs[i]->alive())
+				m_orgs[i]->noteEnergy();
+		if (now == m_cycleEnd)
+			repeatCycle();
+		return;
+	}
+
+	// nothing before a move of the RNG can come back; wait for it to settle
+	if (myrandState() != m_markRng || m_alive != m_markAlive)
+	{
+		m_markRng = myrandState();
+		m_markAlive = m_alive;
+		m_markTick = INVALID_TICK;
+		return;
+	}
+
+	uint64 h = hashCycleState();
+	if (m_markTick != INVALID_TICK && h == m_markHash)
+	{
+		m_cycleStart = new WorldCheckpoint;
+		saveState(*m_cycleStart);
+		m_cycleInstructions = m_instructions;
+		m_cyclePeriod = now - m_markTick;
+		m_cycleEnd = now + m_cyclePeriod;
+		for (uint32 i=0;i<m_orgs.size();i++)
+			m_orgs[i]->watchEnergy(true);
+		return;
+	}
+
+	if (m_markTick == INVALID_TICK || now - m_markTick >= m_markSpan)
+	{
+		m_markSpan = (m_markTick == INVALID_TICK) ? 1 : std::min(m_markSpan*2,(uint32)MAX_CYCLE_PERIOD);
+		m_markTick = now;
+		m_markHash = h;
+	}
+}
+
+static bool sameBesidesEnergy(const OrganismState &a, const OrganismState &b)
+{
+	return(memcmp(a.dna,b.dna,sizeof(a.dna)) == 0 && memcmp(a.regs,b.regs,sizeof(a.regs)) == 0 &&
+		a.ip == b.ip && a.x == b.x && a.y == b.y && a.poked == b.poked &&
+		(a.energy > 0) == (b.energy > 0));
+}
+
+void World::repeatCycle(void)
+{
+	WorldCheckpoint &cp = *m_cycleStart;
+	OrganismState *st = new OrganismState;
+	uint32 now = m_curIteration+1, periods = (m_maxIterations - now) / m_cyclePeriod;
+	bool same = myrandState() == cp.rngState && memcmp(m_foodGrid,cp.foodGrid,sizeof(m_foodGrid)) == 0;
+
+	for (uint32 i=0;i<m_orgs.size();i++)
+	{
+		Organism *org = m_orgs[i];
+		sint32 low, high;
+
+		org->getState(*st);
+		same = same && sameBesidesEnergy(cp.orgs[i],*st);
+		if (same && org->alive())
+		{
+			// the energy each period takes (or gives), against the room
+			// it has before an outcome changes
+			sint64 spent = (sint64)cp.orgs[i].energy - st->energy;
+			if (org->getEnergyWindow(low,high) == false)
+				periods = 0;
+			else if (spent > 0)
+				periods = (uint32)std::min((sint64)periods,-(sint64)low / spent);
+			else if (spent < 0)
+				periods = (uint32)std::min((sint64)periods,(sint64)high / -spent);
+		}
+		org->watchEnergy(false);
+	}
+
+	if (same && periods > 0)
+	{
+		for (uint32 i=0;i<m_orgs.size();i++)
+			if (m_orgs[i]->alive())
+				m_orgs[i]->repeatPeriods(cp.orgs[i],periods);
+		m_score += periods * (m_score - cp.score);
+		m_instructions += periods * (m_instructions - m_cycleInstructions);
+		m_curIteration += periods * m_cyclePeriod;
+		m_cyclesFound++;
+		m_skippedTicks += periods * m_cyclePeriod;
+		m_lastCycleTick = now - m_cyclePeriod;
+	}
+
+	delete st;
+	delete m_cycleStart;
+	m_cycleStart = NULL;
+	m_markTick = INVALID_TICK;
+}
+
+void World::printCycles(FILE *stream)
+{
+	if (m_cyclesFound > 0)
+		fprintf(stream,"Cycles: %u found, %u ticks skipped (the last of %u ticks, from tick %u)\n",
+			m_cyclesFound,m_skippedTicks,m_cyclePeriod,m_lastCycleTick);
+}
+
+void World::saveState(WorldCheckpoint &cp)
+{
+	cp.tick = m_curIteration;
+	cp.rngState = myrandState();
+	cp.score = m_score;
+	memcpy(cp.foodGrid,m_foodGrid,sizeof(m_foodGrid));
+	cp.orgs.resize(m_orgs.size());
+	for (uint32 i=0;i<m_orgs.size();i++)
+		m_orgs[i]->getState(cp.orgs[i]);
+}
+
+void World::restoreState(const WorldCheckpoint &cp)
+{
+	m_curIteration = cp.tick;
+	myrandState() = cp.rngState;
+	m_score = cp.score;
+	memcpy(m_foodGrid,cp.foodGrid,sizeof(m_foodGrid));
+	for (uint32 i=0;i<m_orgs.size() && i<cp.orgs.size();i++)
+		m_orgs[i]->setState(cp.orgs[i]);
+	redrawAll();
+}
+
+bool World::saveSnapshot(const std::string &file, std::string &error)
+{
+	SnapshotHeader h;
+	uint32 i;
+
+	memset(&h,0,sizeof(h));
+	memcpy(h.magic,SNAPSHOT_MAGIC,sizeof(h.magic));
+	h.version = SNAPSHOT_VERSION;
+	h.headerSize = sizeof(SnapshotHeader);
+	h.orgStateSize = sizeof(OrganismState);
+	h.tick = m_curIteration;
+	h.rngState = myrandState();
+	h.seed = m_settings->getSeed();
+	h.score = m_score;
+	h.maxFoodID = m_maxFoodID;
+	h.numOrgs = (uint16)m_orgs.size();
+	h.gridWidth = GRID_WIDTH;
+	h.gridHeight = GRID_HEIGHT;
+	for (i=0;i<MAX_FOOD_ID;i++)
+		h.poisoned[i] = m_poisoned[i] ? 1 : 0;
+	memcpy(h.foodGrid,m_foodGrid,sizeof(m_foodGrid));
+
+	FILE *stream = fopen(file.c_str(),"wb");
+	if (stream == NULL)
+	{
+		error = "unable to create " + file;
+		return(false);
+	}
+
+	bool ok = fwrite(&h,sizeof(h),1,stream) == 1;
+
+	OrganismState *state = new OrganismState;
+	for (i=0;i<m_orgs.size() && ok;i++)
+	{
+		m_orgs[i]->getState(*state);
+		ok = fwrite(state,sizeof(*state),1,stream) == 1;
+	}
+	delete state;
+
+	if (fclose(stream) != 0)
+		ok = false;
+	if (ok == false)
+		error = "unable to write " + file;
+
+	return(ok);
+}
+
+// replaces the state of a freshly populated world.  The file is mapped
+// rather than read; organism records are used in place.
+
+bool World::loadSnapshot(const std::string &file, std::string &error)
+{
+	MappedFile map;
+
+	if (map.open(file) == false)
+	{
+		error = "unable to read " + file;
+		return(false);
+	}
+
+	const uint8 *data = map.getData();
+	size_t size = map.getSize();
+
+	const SnapshotHeader *h = (const SnapshotHeader *)data;
+
+	if (size < sizeof(SnapshotHeader) || memcmp(h->magic,SNAPSHOT_MAGIC,sizeof(h->magic)) != 0)
+		error = file + " is not a world snapshot";
+	else if (h->version != SNAPSHOT_VERSION || h->headerSize != sizeof(SnapshotHeader) ||
+			 h->orgStateSize != sizeof(OrganismState) ||
+			 h->gridWidth != GRID_WIDTH || h->gridHeight != GRID_HEIGHT)
+		error = file + " was written by an incompatible version";
+	else if (h->numOrgs != m_orgs.size())
+		error = file + " has a different number of organisms";
+	else if (size != sizeof(SnapshotHeader) + h->numOrgs * sizeof(OrganismState))
+		error = file + " is truncated";
+	else
+	{
+		const OrganismState *orgs = (const OrganismState *)(data + sizeof(SnapshotHeader));
+
+		m_curIteration = h->tick;
+		myrandState() = h->rngState;
+		m_score = h->score;
+		m_maxFoodID = h->maxFoodID;
+		for (uint32 i=0;i<MAX_FOOD_ID;i++)
+			m_poisoned[i] = h->poisoned[i] != 0;
+		memcpy(m_foodGrid,h->foodGrid,sizeof(m_foodGrid));
+		for (uint32 i=0;i<m_orgs.size();i++)
+			m_orgs[i]->setState(orgs[i]);
+
+		// report the run under the seed it started with
+		m_settings->setSeed(h->seed);
+		redrawAll();
+	}
+
+	return(error.length() == 0);
+}
+
+// take a checkpoint when one is due.  Memory is bounded by MAX_CHECKPOINTS:
+// when full, every other checkpoint is dropped and the spacing doubles, so
+// a rewind never replays more than about 2 * run length / MAX_CHECKPOINTS
+
+void World::updateCheckpoints(void)
+{
+	if (m_curIteration < m_nextCheckpoint)
+		return;
+
+	WorldCheckpoint *cp = new WorldCheckpoint;
+	saveState(*cp);
+	m_checkpoints.push_back(cp);
+
+	if (m_checkpoints.size() > MAX_CHECKPOINTS)
+	{
+		uint32 i, kept = 0;
+		for (i=0;i<m_checkpoints.size();i++)
+		{
+			if (i % 2 == 0)
+				m_checkpoints[kept++] = m_checkpoints[i];
+			else
+				delete m_checkpoints[i];
+		}
+		m_checkpoints.resize(kept);
+		m_checkpointInterval *= 2;
+	}
+
+	m_nextCheckpoint = m_curIteration + m_checkpointInterval;
+}
+
+// called from the debugger mid-tick; the rewind itself happens once the
+// tick completes (see run)
+
+bool World::rewind(uint32 tick)
+{
+	if (m_checkpoints.size() == 0 || m_checkpoints[0]->tick > tick)
+		return(false);
+
+	m_rewindTo = tick;
+	return(true);
+}
+
+uint32 World::restoreCheckpoint(void)
+{
+	// latest checkpoint at or before the target; later ones are dropped
+	// since replaying re-creates them (minus any debugger edits)
+
+	uint32 i = m_checkpoints.size();
+	while (i > 1 && m_checkpoints[i-1]->tick > m_rewindTo)
+		delete m_checkpoints[--i];
+	m_checkpoints.resize(i);
+
+	restoreState(*m_checkpoints[i-1]);
+	m_nextCheckpoint = m_curIteration + m_checkpointInterval;
+	m_rewindTo = INVALID_TICK;
+
+	return(m_curIteration);
+}
+
+bool World::attachConditionMet(void)
+{
+	if (m_settings->getAttachTick() != 0 && m_curIteration >= m_settings->getAttachTick())
+		return(true);
+	if (m_settings->getAttachEnergy() != 0 && 
+		(sint32)m_attachTarget->getEnergy() < m_settings->getAttachEnergy())
+		return(true);
+	if (m_settings->getAttachPoked() && m_attachTarget->wasPoked())
+		return(true);
+	return(false);
+}
+
+void World::attachDebugger(void)
+{
+	m_attachTarget->setSingleStep(true);
+	m_attachTarget = NULL;
+	m_frameTicks = 1;			// the debugger sees every tick
+	m_frameNs = 0;
+
+	m_quiet = false;
+	m_console->clearScreen();
+	redrawAll();
+	showDisplay();
+}
+
+
+bool World::generatePower(Organism *me, uint16 energyToRelease)
+{
+	if (m_foodGrid[me->getY()][me->getX()] == COLLECTION_POINT_ID)
+	{
+		m_score += (double)energyToRelease;
+		return(true);
+	}
+
+	return(false);
+}
+
+void World::terminate(void)
+{
+	m_terminate = true;
+}
+
+
+bool World::populateWorld
+(
+	 OrganismBinary *player,
+	 OrganismBinary *drone
+)
+{
+	uint16 numOrganisms = m_settings->getMaxOrganisms();
+	uint16 i,x,y;
+	uint16 arr[MAX_DNA];
+
+	player->getProgram(arr);
+
+	for (i=0;i<numOrganisms;i++)
+	{
+		bool debugMe = m_settings->getSingleStep() && i == m_settings->getSingleStepID();
+
+		Organism *org  = new Organism(	this, 
+										arr, 
+										player->getProgramSize(),
+										START_ENERGY, 
+										i,
+										debugMe && !m_settings->getAttachDeferred(),
+										player->getModuleInfo(), 
+										m_settings->getTraceOrg(i) ? m_trace : NULL, 
+										false,
+										m_console);
+		if (org == NULL)
+			return(false);
+
+		// only the entrant is profiled: its source is the one annotated
+		org->setProfile(m_profile);
+
+		if (debugMe && m_settings->getAttachDeferred())
+			m_attachTarget = org;
+
+		do
+		{
+			x = (uint16)(myrand() % GRID_WIDTH);
+			y = (uint16)(myrand() % GRID_HEIGHT);
+		} while (addNewOrganism(x,y,org) == false);
+	}
+
+
+	uint16 numDrones = m_settings->getMaxDrones();
+
+	drone->getProgram(arr);
+
+	for (i=0;i<numDrones;i++)
+	{
+		Organism *org  = new Organism(	this, 
+										arr, 
+										drone->getProgramSize(),
+										START_ENERGY, 
+										i+numOrganisms,
+										false,
+										DRONE_STRING, 
+										m_settings->getTraceOrg(i+numOrganisms) ? m_trace : NULL, 
+										true,
+										m_console);
+		if (org == NULL)
+			return(false);
+
+		do
+		{
+			x = (uint16)(myrand() % GRID_WIDTH);
+			y = (uint16)(myrand() % GRID_HEIGHT);
+		} while (addNewOrganism(x,y,org) == false);
+	}
+
+	// every organism takes the hook path, observed by a profile nobody reads
+	if (m_engine == ENGINE_HOOKED)
+	{
+		m_engineProfile = new ExecProfile(true);
+		for (i=0;i<m_orgs.size();i++)
+			if (m_orgs[i]->getProfile() == NULL)
+				m_orgs[i]->setProfile(m_engineProfile);
+	}
+
+	return(true);
+}
+
+static char foodChar(uint16 foodID)
+{
+	if (foodID == COLLECTION_POINT_ID)
+		return('$');
+	return(foodID > 0 ? '*' : ' ');
+}
+
+// --fps/--frame: whether to draw after this tick.  Under --fps the clock
+// is only read every FRAME_CLOCK_TICKS ticks
+
+bool World::frameDue(void)
+{
+	if (m_quiet)
+		return(false);
+	if (m_frameNs != 0)
+	{
+		if (m_curIteration % FRAME_CLOCK_TICKS != 0)
+			return(false);
+		uint64 now = PhaseProfile::now();
+		if (now < m_nextFrame)
+			return(false);
+		m_nextFrame = now + m_frameNs;
+		return(true);
+	}
+	return(m_frameTicks == 1 || (m_curIteration + 1) % m_frameTicks == 0);
+}
+
+void World::showDisplay(void)
+{
+	if (m_quiet == true)
+		return;
+
+	char temp[256];
+	bool framed = m_frameTicks != 1 || m_frameNs != 0;
+
+	// a frame that skipped ticks shows the score of the one it is on
+	if (m_curIteration % 100 == 0 || m_settings->getSingleStep() || m_redrawAll == true || framed)
+	{
+		sprintf(temp,"Score: %.0lf, Ticks: %d of %d   (Seed=%u)",m_score,m_curIteration,m_maxIterations,m_settings->getSeed());
+		m_console->gotoXY(SCORE_X,SCORE_Y);
+		m_console->printString(temp);
+	}
+
+	if (m_redrawAll)
+	{
+		m_redrawAll = false;
+
+		for (int i=0;i<GRID_HEIGHT;i++)
+		{
+			for (int j=0;j<GRID_WIDTH;j++)
+			{
+				m_shown[i][j] = foodChar(m_foodGrid[i][j]);
+				m_console->gotoXY(START_X+j,START_Y+i);
+				m_console->printChar(m_shown[i][j]);
+			}
+		}
+
+		unsigned int size = m_orgs.size();
+
+		for (unsigned int k=0;k<size;k++)
+		{
+			uint16 x = m_orgs[k]->getX(), y = m_orgs[k]->getY();
+			if (x < GRID_WIDTH && y < GRID_HEIGHT)
+				m_shown[y][x] = m_orgs[k]->getDisplayChar();
+			m_console->gotoXY(START_X + x,START_Y + y);
+			m_console->printChar(m_orgs[k]->getDisplayChar());
+		}
+		memset(m_dirty,0,sizeof(m_dirty));
+	}
+	else
+		drawDirtyCells();
+
+	m_console->refresh();
+}
+
+// every change to what a cell shows marks it (moves, food eaten and grown
+// back, deaths and revivals); a frame works out what the marked cells show
+// now and prints only those that differ from the last frame, so the cost
+// follows the activity rather than the population
+
+void World::drawDirtyCells(void)
+{
+	char glyph[GRID_HEIGHT*GRID_WIDTH];
+	const uint32 words = sizeof(m_dirty)/sizeof(m_dirty[0]);
+	uint32 marked = 0, w, b;
+
+	for (w=0;w<words;w++)
+		if (m_dirty[w] != 0)
+			for (b=0;b<32;b++)
+				if (m_dirty[w] & (1U << b))
+				{
+					uint32 cell = w*32 + b;
+					glyph[cell] = foodChar(m_foodGrid[cell / GRID_WIDTH][cell % GRID_WIDTH]);
+					++marked;
+				}
+	if (marked == 0)
+		return;
+
+	for (uint32 k=0;k<m_orgs.size();k++)
+	{
+		uint16 x = m_orgs[k]->getX(), y = m_orgs[k]->getY();
+		uint32 cell = y*GRID_WIDTH + x;
+		if (x < GRID_WIDTH && y < GRID_HEIGHT && (m_dirty[cell / 32] & (1U << (cell % 32))))
+			glyph[cell] = m_orgs[k]->getDisplayChar();
+	}
+
+	for (w=0;w<words;w++)
+	{
+		if (m_dirty[w] == 0)
+			continue;
+		for (b=0;b<32;b++)
+			if (m_dirty[w] & (1U << b))
+			{
+				uint32 cell = w*32 + b;
+				uint16 x = cell % GRID_WIDTH, y = cell / GRID_WIDTH;
+				if (m_shown[y][x] != glyph[cell])
+				{
+					m_shown[y][x] = glyph[cell];
+					m_console->gotoXY(START_X+x,START_Y+y);
+					m_console->printChar(glyph[cell]);
+				}
+			}
+		m_dirty[w] = 0;
+	}
+}
+
+
+void World::getNumAlive(uint16 *orgs, uint16 *drones)
+{
+	*orgs = *drones = 0;
+
+	for (uint32 i=0;i<m_orgs.size();i++)
+		if (m_orgs[i]->alive())
+		{
+			if (m_orgs[i]->getModuleName() == "drone")
+				++(*drones);
+			else 
+				++(*orgs);
+		}
+}
+
+void World::addLedgers(SpeciesLedger &clones, SpeciesLedger &drones)
+{
+	for (uint32 i=0;i<m_orgs.size();i++)
+	{
+		SpeciesLedger &l = (m_orgs[i]->getModuleName() == DRONE_STRING) ? drones : clones;
+		l.add(m_orgs[i]->getLedger(),m_orgs[i]->getSignedEnergy());
+	}
+}
+
+void World::printLedger(FILE *stream)
+{
+	SpeciesLedger clones, drones;
+	char name[16];
+
+	fprintf(stream,"Energy ledger:\n");
+	printLedgerHeader(stream,"organism");
+	for (uint32 i=0;i<m_orgs.size();i++)
+	{
+		Organism *org = m_orgs[i];
+		sprintf(name,"%c %u",org->getDisplayChar(),org->getID());
+		printLedgerLine(stream,name,org->getLedger(),org->getSignedEnergy());
+	}
+
+	addLedgers(clones,drones);
+	printLedgerLine(stream,"clones",clones);
+	printLedgerLine(stream,"drones",drones);
+}
+
+void World::getFeatures(WorldFeatures &features)
+{
+	uint32 foodCells = 0, poisonCells = 0;
+	vector<Coord> points;
+
+	for (int i=0;i<GRID_HEIGHT;i++)
+		for (int j=0;j<GRID_WIDTH;j++)
+		{
+			if (m_foodGrid[i][j] == COLLECTION_POINT_ID)
+				points.push_back(Coord((uint16)j,(uint16)i));
+			else if (m_foodGrid[i][j] > 0)
+			{
+				++foodCells;
+				if (m_poisoned[m_foodGrid[i][j]])
+					++poisonCells;
+			}
+		}
+
+	features.numFoodIDs = m_maxFoodID;
+	features.poisonRatio = foodCells ? (double)poisonCells / foodCells : 0;
+
+	// collection points: mean manhattan distance from their centroid
+
+	double cx = 0, cy = 0;
+	size_t k;
+
+	for (k=0;k<points.size();k++)
+	{
+		cx += points[k].x;
+		cy += points[k].y;
+	}
+
+	features.collectionDispersion = 0;
+	if (points.size())
+	{
+		cx /= points.size();
+		cy /= points.size();
+		for (k=0;k<points.size();k++)
+			features.collectionDispersion += fabs(points[k].x - cx) + fabs(points[k].y - cy);
+		features.collectionDispersion /= points.size();
+	}
+
+	// drones: mean manhattan distance from each clone to its nearest drone
+
+	uint32 numClones = 0;
+	double total = 0;
+
+	for (uint32 i=0;i<m_orgs.size();i++)
+	{
+		if (m_orgs[i]->getModuleName() == DRONE_STRING)
+			continue;
+
+		int nearest = GRID_WIDTH + GRID_HEIGHT;
+		for (uint32 j=0;j<m_orgs.size();j++)
+		{
+			if (m_orgs[j]->getModuleName() != DRONE_STRING)
+				continue;
+			int d = abs(m_orgs[i]->getX() - m_orgs[j]->getX()) + 
+					abs(m_orgs[i]->getY() - m_orgs[j]->getY());
+			if (d < nearest)
+				nearest = d;
+		}
+
+		total += nearest;
+		++numClones;
+	}
+
+	features.droneProximity = numClones ? total / numClones : 0;
+}
@@ -1,117 +1,240 @@
-//----------------------------------------------------------------------------
-//
-// world.h
-//
-//----------------------------------------------------------------------------
-//
-// Copyright (c) 2006, Symantec Corporation All rights reserved.
-//
-// Redistribution and use in source and binary forms, with or without
-// modification, are permitted provided that the following conditions are
-// met:
-//
-// -  Redistributions of source code must retain the above copyright notice,
-// this list of conditions and the following disclaimer. 
-//
-// -  Redistributions in binary form must reproduce the above copyright
-// notice, this list of conditions and the following disclaimer in the
-// documentation and/or other materials provided with the distribution. 
-//
-// - Neither the name of Symantec Corp. nor the names of its contributors
-// may be used to endorse or promote products derived from this software
-// without specific prior written permission. 
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
-// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
-// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
-// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-//
-
-#ifndef _WORLD_H_
-#define _WORLD_H_
-
-#include <vector>
-#include <string>
-
-#include "types.h"
-#include "constants.h"
-#include "settings.h"
-#include "mycon.h"
-#include "compiler.h"
-
-class Organism;
-
-struct Coord
-{
-	Coord(uint16 x, uint16 y)
-	{
-		this->x = x;
-		this->y = y;
-	}
-	uint16 x, y;
-};
-
-class World
-{
-public:
-
-	World(Settings *settings,CConsole *console);
-	bool populateWorld(OrganismBinary *player,OrganismBinary *drone);
-	~World();
-	Organism *occupied(uint16 x, uint16 y);
-	uint16 getFoodID(uint16 x, uint16 y);
-	bool eatFood(Organism *me, uint16 x, uint16 y);	// returns true if food was eaten
-	bool addNewOrganism(uint16 newX,uint16 newY,Organism *newOrg);
-	bool generatePower(Organism *me,uint16 energyToRelease);
-	void run(void);
-	void getNumAlive(uint16 *orgs, uint16 *drones);
-	void terminate(void);
-	void redrawAll(void)
-	{
-		m_redrawAll = true;
-	}
-
-	double getScore(void)
-	{
-		return(m_score);
-	}
-	uint32 getTickNum(void)
-	{
-		return(m_curIteration);
-	}
-
-	void setQuiet(bool quiet)
-	{
-		m_quiet = quiet;
-	}
-	void showDisplay(void);
-
-private:
-	bool tick(void);
-
-private:
-	std::vector<Organism *>	m_orgs;
-	uint16					m_foodGrid[GRID_HEIGHT][GRID_WIDTH];
-	uint16					m_maxFoodID;
-	double					m_score;
-	uint32					m_maxIterations;
-	bool					m_poisoned[MAX_FOOD_ID+1];
-	bool					m_terminate;
-	Settings				*m_settings;
-	CConsole				*m_console;
-	uint32					m_curIteration;
-	std::vector<Coord>		m_foodCoords;
-	bool					m_redrawAll;
-	bool					m_quiet;
-	FILE					*m_debugStream;
-};
-
-
-#endif // #ifndef _WORLD_H_
+//----------------------------------------------------------------------------
+//
+// world.h
+//
+//----------------------------------------------------------------------------
+//
+// Copyright (c) 2006, Symantec Corporation All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// -  Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer. 
+//
+// -  Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution. 
+//
+// - Neither the name of Symantec Corp. nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission. 
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef _WORLD_H_
+#define _WORLD_H_
+
+#include <vector>
+#include <string>
+
+#include "types.h"
+#include "constants.h"
+#include "settings.h"
+#include "mycon.h"
+#include "compiler.h"
+#include "ledger.h"
+#include "phase.h"
+#include "perfcount.h"
+#include "statehash.h"
+
+class Organism;
+class TraceWriter;
+class ExecProfile;
+struct WorldCheckpoint;
+
+struct Coord
+{
+	Coord(uint16 x, uint16 y)
+	{
+		this->x = x;
+		this->y = y;
+	}
+	uint16 x, y;
+};
+
+// per-seed characteristics of a freshly populated world
+struct WorldFeatures
+{
+	uint16	numFoodIDs;
+	double	poisonRatio;			// fraction of food cells that are poisonous
+	double	collectionDispersion;	// mean distance of collection points from their centroid
+	double	droneProximity;			// mean distance from each clone to its nearest drone
+};
+
+class World
+{
+public:
+
+	World(Settings *settings,CConsole *console);
+	bool populateWorld(OrganismBinary *player,OrganismBinary *drone);
+	~World();
+	Organism *occupied(uint16 x, uint16 y);
+	uint16 getFoodID(uint16 x, uint16 y);
+	bool eatFood(Organism *me, uint16 x, uint16 y);	// returns true if food was eaten
+	bool addNewOrganism(uint16 newX,uint16 newY,Organism *newOrg);
+	bool generatePower(Organism *me,uint16 energyToRelease);
+	void run(void);
+	bool step(void);
+	void setEngine(uint16 engine)
+	{
+		m_engine = engine;			// before populateWorld
+	}
+	void enableHashing(void);		// after populateWorld
+	uint64 hashState(void);
+	uint32 getNumOrganisms(void)
+	{
+		return(m_orgs.size());
+	}
+	Organism *getOrganism(uint32 i)
+	{
+		return(m_orgs[i]);
+	}
+	void getNumAlive(uint16 *orgs, uint16 *drones);
+	void getFeatures(WorldFeatures &features);
+	bool rewind(uint32 tick);
+	bool saveSnapshot(const std::string &file, std::string &error);
+	bool loadSnapshot(const std::string &file, std::string &error);
+	std::string getError(void)
+	{
+		return(m_error);
+	}
+	uint32 getTraceDropped(void);
+	void addLedgers(SpeciesLedger &clones, SpeciesLedger &drones);
+	void printLedger(FILE *stream);
+	PhaseProfile *getPhases(void)
+	{
+		return(m_phases);
+	}
+	uint64 getInstructions(void)
+	{
+		return(m_instructions);
+	}
+	uint32 getRunTicks(void)
+	{
+		return(m_runTicks);
+	}
+	void printPerf(FILE *stream)
+	{
+		if (m_perf != NULL)
+			m_perf->print(stream,m_instructions,m_runTicks);
+	}
+	void printCycles(FILE *stream);
+	void setProfile(ExecProfile *profile)
+	{
+		m_profile = profile;		// before populateWorld
+	}
+	void terminate(void);
+	void redrawAll(void)
+	{
+		m_redrawAll = true;
+	}
+	void markCell(uint16 x, uint16 y)
+	{
+		// what (x,y) shows may have changed since the last frame
+		if (x < GRID_WIDTH && y < GRID_HEIGHT)
+			m_dirty[(y*GRID_WIDTH + x) / 32] |= 1U << ((y*GRID_WIDTH + x) % 32);
+	}
+
+	double getScore(void)
+	{
+		return(m_score);
+	}
+	uint32 getTickNum(void)
+	{
+		return(m_curIteration);
+	}
+	uint32 getTicksSince(uint32 tick, uint16 org)
+	{
+		// ENGINE_SLEEP: counting this tick if org's turn in it has come
+		return(m_curIteration - tick + (m_turnTick == m_curIteration && org < m_turn ? 1 : 0));
+	}
+
+	void setQuiet(bool quiet)
+	{
+		m_quiet = quiet;
+	}
+	void showDisplay(void);
+
+private:
+	bool tick(void);
+	bool frameDue(void);
+	void drawDirtyCells(void);
+	uint32 tickSleeping(void);
+	bool attachConditionMet(void);
+	void attachDebugger(void);
+	void saveState(WorldCheckpoint &cp);
+	void restoreState(const WorldCheckpoint &cp);
+	void updateCheckpoints(void);
+	uint32 restoreCheckpoint(void);
+	uint64 hashCycleState(void);
+	void findCycle(void);
+	void repeatCycle(void);
+
+private:
+	std::vector<Organism *>	m_orgs;
+	uint16					m_foodGrid[GRID_HEIGHT][GRID_WIDTH];
+	uint16					m_maxFoodID;
+	double					m_score;
+	uint32					m_maxIterations;
+	bool					m_poisoned[MAX_FOOD_ID+1];
+	bool					m_terminate;
+	Settings				*m_settings;
+	CConsole				*m_console;
+	uint32					m_curIteration;
+	uint32					m_dirty[(GRID_HEIGHT*GRID_WIDTH+31)/32];	// cells to look at next frame...
+	char					m_shown[GRID_HEIGHT][GRID_WIDTH];			// ...against what the last one drew
+	bool					m_redrawAll;
+	bool					m_quiet;
+	TraceWriter				*m_trace;			// -l; shared by the traced organisms
+	ExecProfile				*m_profile;			// --profile; owned by the caller
+	PhaseProfile			*m_phases;			// --phases
+	PerfCounters			*m_perf;			// --perf; NULL if unavailable
+	uint32					m_frameTicks;		// --frame; 1 draws every tick
+	uint64					m_frameNs;			// --fps; 0 if uncapped
+	uint64					m_nextFrame;
+	uint16					m_engine;			// ENGINE_xxx
+	uint32					m_turn;				// ENGINE_SLEEP: organism running...
+	uint32					m_turnTick;			// ...in this tick
+	ExecProfile				*m_engineProfile;	// ENGINE_HOOKED
+	bool					m_hashing;			// --verify: keep m_foodHash current
+	uint64					m_foodHash;
+	uint64					m_instructions;		// executed by run()...
+	uint32					m_runTicks;			// ...over this many ticks
+	uint32					m_alive;			// after the last tick
+	bool					m_findCycles;		// --cycles, where nothing forbids it
+	uint32					m_markTick;			// state hash taken here...
+	uint64					m_markHash;
+	uint32					m_markRng;
+	uint32					m_markAlive;
+	uint32					m_markSpan;			// ...and moved on after this many ticks
+	WorldCheckpoint			*m_cycleStart;		// replaying a repeat from here...
+	uint32					m_cycleEnd;			// ...to this tick
+	uint32					m_cyclePeriod;
+	uint64					m_cycleInstructions;
+	uint32					m_cyclesFound;		// and skipped
+	uint32					m_skippedTicks;
+	uint32					m_lastCycleTick;
+	Organism				*m_attachTarget;	// -g:X@cond organism still waiting
+	bool					m_reversible;		// debugging: keep checkpoints for bac(k)
+	std::vector<WorldCheckpoint *> m_checkpoints;
+	uint32					m_checkpointInterval;
+	uint32					m_nextCheckpoint;
+	uint32					m_rewindTo;
+	std::string				m_error;			// reported after run()
+};
+
+
+#endif // #ifndef _WORLD_H_